@@ -0,0 +1,6 @@
+#ifndef CATCH_CONFIG_MAIN
+#define CATCH_CONFIG_MAIN
+#endif
+#define DO_NOT_USE_WMAIN
+
+#include <catch2/catch.hpp>
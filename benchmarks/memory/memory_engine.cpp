@@ -0,0 +1,193 @@
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <catch2/catch.hpp>
+
+#include <algo/memory/bitmap_engine.h>
+#include <algo/memory/engine.h>
+#include <algo/memory/requests.h>
+#include <algo/memory/strategies.h>
+#include <algo/memory/types.h>
+
+namespace mm = MemoryManagement;
+using std::vector;
+
+namespace {
+/**
+ *  @brief Количество запрошенных и фактически выделенных страниц.
+ *
+ *  Разница между ними - внутренняя фрагментация памяти.
+ */
+struct AllocationStats {
+  int64_t requested = 0;
+  int64_t allocated = 0;
+};
+
+/**
+ *  @brief Формирует последовательность заявок и применяет ее к @a engine.
+ *
+ *  Заявки на выделение небольших блоков памяти чередуются с заявками на
+ *  освобождение случайных блоков, поэтому память сильно фрагментируется.
+ */
+vector<mm::Request> generateRequests(const mm::StrategyPtr &strategy,
+                                     mm::MemoryEngine &engine,
+                                     uint32_t count,
+                                     std::mt19937 &random,
+                                     AllocationStats &stats) {
+  const auto &config = engine.config();
+  std::uniform_int_distribution<int32_t> pids(0, 255), pages(1, 16),
+      types(0, 99);
+
+  vector<mm::Request> requests;
+  requests.reserve(count);
+  for (uint32_t i = 0; i < count; ++i) {
+    auto pid = pids(random);
+    auto bytes = static_cast<int64_t>(pages(random)) * config.pageSize();
+    auto type = types(random);
+
+    mm::Request request = mm::TerminateProcessReq(pid);
+    if (!engine.hasProcess(pid)) {
+      request = mm::CreateProcessReq(pid, bytes, config);
+    } else if (type < 60) {
+      request = mm::AllocateMemory(pid, bytes, config);
+    } else if (type < 99) {
+      auto blocks = engine.processBlocks(pid);
+      std::uniform_int_distribution<size_t> index(0, blocks.size() - 1);
+      request = mm::FreeMemory(pid, blocks[index(random)]->address(), config);
+    }
+
+    auto totalFree = engine.totalFree();
+    strategy->processRequest(request, engine);
+    requests.push_back(request);
+
+    // память выделена, если свободной памяти стало меньше
+    if (auto allocated = totalFree - engine.totalFree(); allocated > 0) {
+      stats.requested += config.toPages(bytes);
+      stats.allocated += allocated;
+    }
+  }
+  return requests;
+}
+} // namespace
+
+TEST_CASE("MemoryManagement::MemoryEngine (1M страниц)") {
+  const mm::MemoryConfig config{1 << 20, 4096};
+
+  vector<mm::StrategyPtr> strategies = {
+      mm::FirstAppropriateStrategy::create(),
+      mm::NextAppropriateStrategy::create(),
+      mm::MostAppropriateStrategy::create(),
+      mm::LeastAppropriateStrategy::create(),
+      mm::BuddyStrategy::create(),
+      mm::TlsfStrategy::create()};
+
+  for (const auto &strategy : strategies) {
+    std::mt19937 random(2020);
+
+    // фрагментируем память: в результате в ней несколько десятков тысяч блоков
+    AllocationStats stats;
+    mm::MemoryEngine engine(mm::MemoryState::initial(config));
+    generateRequests(strategy, engine, 100000, random, stats);
+
+    auto base = engine;
+    auto requests = generateRequests(strategy, engine, 1000, random, stats);
+
+    WARN(strategy->toString()
+         << ": запрошено страниц " << stats.requested << ", выделено "
+         << stats.allocated << ", свободных блоков "
+         << base.state().freeBlocks.size());
+
+    // наибольшее время обработки одной заявки
+    std::chrono::nanoseconds worst{0};
+    auto copy = base;
+    for (const auto &request : requests) {
+      auto start = std::chrono::steady_clock::now();
+      strategy->processRequest(request, copy);
+      worst = std::max(worst, std::chrono::steady_clock::now() - start);
+    }
+    WARN(strategy->toString() << ": наибольшее время обработки заявки "
+                              << worst.count() << " нс");
+
+    auto baseState = base.state();
+    mm::BitmapMemoryEngine baseBitmap(baseState);
+
+    BENCHMARK_ADVANCED(strategy->toString() + ": 1000 заявок на месте")
+    (Catch::Benchmark::Chronometer meter) {
+      vector<mm::MemoryEngine> engines(meter.runs(), base);
+      meter.measure([&](int run) {
+        for (const auto &request : requests) {
+          strategy->processRequest(request, engines[run]);
+        }
+        return engines[run].blocks().size();
+      });
+    };
+
+    BENCHMARK_ADVANCED(strategy->toString() +
+                       ": 1000 заявок на месте (битовая карта)")
+    (Catch::Benchmark::Chronometer meter) {
+      vector<mm::BitmapMemoryEngine> engines(meter.runs(), baseBitmap);
+      meter.measure([&](int run) {
+        for (const auto &request : requests) {
+          strategy->processRequest(request, engines[run]);
+        }
+        return engines[run].totalFree();
+      });
+    };
+
+    BENCHMARK(strategy->toString() + ": 10 заявок с копированием состояния") {
+      auto state = baseState;
+      for (size_t i = 0; i < 10; ++i) {
+        state = strategy->processRequest(requests[i], state);
+      }
+      return state.blocks.size();
+    };
+  }
+}
+
+TEST_CASE("MemoryManagement::MemoryEngine (уплотнение памяти)") {
+  // памяти мало, поэтому уплотнение выполняется часто
+  const mm::MemoryConfig config{2048, 4096};
+
+  vector<mm::StrategyPtr> strategies = {
+      mm::FirstAppropriateStrategy::create(),
+      mm::NextAppropriateStrategy::create(),
+      mm::MostAppropriateStrategy::create(),
+      mm::LeastAppropriateStrategy::create(),
+      mm::TlsfStrategy::create()};
+
+  for (const auto &strategy : strategies) {
+    for (auto mode : {mm::CompactionMode::FULL, mm::CompactionMode::MINIMAL}) {
+      auto name = strategy->toString() +
+                  (mode == mm::CompactionMode::FULL ? " (дефрагментация)"
+                                                    : " (минимальный сдвиг)");
+      std::mt19937 random(2020);
+
+      AllocationStats stats;
+      mm::MemoryEngine engine(mm::MemoryState::initial(config));
+      engine.setCompaction(mode);
+      generateRequests(strategy, engine, 10000, random, stats);
+
+      auto base = engine;
+      auto requests = generateRequests(strategy, engine, 1000, random, stats);
+
+      WARN(name << ": сдвинуто страниц " << base.pagesMoved() << " за 10000 "
+                << "заявок, " << engine.pagesMoved() - base.pagesMoved()
+                << " за 1000 заявок");
+
+      BENCHMARK_ADVANCED(name + ": 1000 заявок на месте")
+      (Catch::Benchmark::Chronometer meter) {
+        vector<mm::MemoryEngine> engines(meter.runs(), base);
+        meter.measure([&](int run) {
+          for (const auto &request : requests) {
+            strategy->processRequest(request, engines[run]);
+          }
+          return engines[run].blocks().size();
+        });
+      };
+    }
+  }
+}
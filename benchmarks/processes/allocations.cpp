@@ -0,0 +1,25 @@
+#include <cstddef>
+#include <cstdlib>
+#include <new>
+
+#include "allocations.h"
+
+namespace {
+std::size_t allocations = 0;
+} // namespace
+
+// Операторы определены в отдельной единице трансляции, чтобы компилятор не
+// встраивал их в код, выделяющий память
+void *operator new(std::size_t size) {
+  ++allocations;
+  if (auto *ptr = std::malloc(size == 0 ? 1 : size)) {
+    return ptr;
+  }
+  throw std::bad_alloc();
+}
+
+void operator delete(void *ptr) noexcept { std::free(ptr); }
+
+void operator delete(void *ptr, std::size_t) noexcept { std::free(ptr); }
+
+std::size_t allocationsCount() { return allocations; }
@@ -0,0 +1,12 @@
+#pragma once
+
+#include <cstddef>
+
+/**
+ *  @brief Возвращает количество выделений динамической памяти с момента
+ *  запуска программы.
+ *
+ *  Выделения считаются заменой глобальных операторов new и delete, поэтому
+ *  файл allocations.cpp подключается только к отдельной программе.
+ */
+std::size_t allocationsCount();
@@ -0,0 +1,173 @@
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <utility>
+#include <vector>
+
+#include <catch2/catch.hpp>
+
+#include <algo/processes/requests.h>
+#include <algo/processes/strategies.h>
+#include <algo/processes/types.h>
+
+#include "allocations.h"
+
+namespace pm = ProcessesManagement;
+using std::vector;
+
+namespace {
+/**
+ *  @brief Формирует последовательность заявок и применяет ее к @a state.
+ *
+ *  Процессы создаются чаще, чем завершаются, поэтому в состоянии
+ *  накапливается около двухсот процессов.
+ */
+vector<pm::Request> generateRequests(const pm::StrategyPtr &strategy,
+                                     pm::ProcessesState &state,
+                                     uint32_t count,
+                                     std::mt19937 &random) {
+  std::uniform_int_distribution<int32_t> pids(0, 255), workTimes(1, 30),
+      types(0, 99);
+  std::uniform_int_distribution<size_t> priorities(0, 11);
+
+  vector<pm::Request> requests;
+  requests.reserve(count);
+  for (uint32_t i = 0; i < count; ++i) {
+    auto pid = pids(random);
+    auto type = types(random);
+    auto current = state.executingIndex();
+
+    pm::Request request = pm::TimeQuantumExpired();
+    if (type < 35) {
+      request = pm::CreateProcessReq(
+          pid, -1, priorities(random), 0, 0, workTimes(random));
+    } else if (type < 45) {
+      request = pm::TerminateProcessReq(pid);
+    } else if (type < 60 && current) {
+      request = pm::InitIO(state.processes[*current].pid());
+    } else if (type < 75) {
+      request = pm::TerminateIO(pid);
+    } else if (type < 85 && current) {
+      request = pm::TransferControl(state.processes[*current].pid());
+    }
+
+    state = strategy->processRequest(request, std::move(state));
+    requests.push_back(request);
+  }
+  return requests;
+}
+} // namespace
+
+TEST_CASE("ProcessesManagement::AbstractStrategy::processRequest") {
+  vector<pm::StrategyPtr> strategies = {pm::RoundRobinStrategy::create(),
+                                        pm::FcfsStrategy::create(),
+                                        pm::SjnStrategy::create(),
+                                        pm::SrtStrategy::create(),
+                                        pm::WinNtStrategy::create(),
+                                        pm::UnixStrategy::create(),
+                                        pm::LinuxO1Strategy::create(),
+                                        pm::CfsStrategy::create()};
+
+  for (const auto &strategy : strategies) {
+    std::mt19937 random(2020);
+
+    auto state = pm::ProcessesState::initial();
+    generateRequests(strategy, state, 2000, random);
+
+    auto base = state;
+    auto requests = generateRequests(strategy, state, 1000, random);
+
+    // выделения памяти на одну заявку при копировании и при перемещении
+    // состояния
+    auto copied = base;
+    auto before = allocationsCount();
+    for (const auto &request : requests) {
+      copied = strategy->processRequest(request, copied);
+    }
+    auto copying = allocationsCount() - before;
+
+    auto moved = base;
+    before = allocationsCount();
+    for (const auto &request : requests) {
+      moved = strategy->processRequest(request, std::move(moved));
+    }
+    auto moving = allocationsCount() - before;
+
+    REQUIRE(copied == moved);
+    WARN(strategy->toString()
+         << ": процессов " << base.processes.size()
+         << ", выделений памяти на заявку: с копированием состояния "
+         << static_cast<double>(copying) / requests.size()
+         << ", с перемещением "
+         << static_cast<double>(moving) / requests.size());
+
+    BENCHMARK(strategy->toString() + ": 1000 заявок с копированием состояния") {
+      auto state = base;
+      for (const auto &request : requests) {
+        state = strategy->processRequest(request, state);
+      }
+      return state.processes.size();
+    };
+
+    BENCHMARK_ADVANCED(strategy->toString() +
+                       ": 1000 заявок с перемещением состояния")
+    (Catch::Benchmark::Chronometer meter) {
+      vector<pm::ProcessesState> states(meter.runs(), base);
+      meter.measure([&](int run) {
+        for (const auto &request : requests) {
+          states[run] =
+              strategy->processRequest(request, std::move(states[run]));
+        }
+        return states[run].processes.size();
+      });
+    };
+  }
+}
+
+TEST_CASE("ProcessesManagement::dispatchRequest") {
+  vector<pm::StrategyPtr> strategies = {pm::RoundRobinStrategy::create(),
+                                        pm::FcfsStrategy::create(),
+                                        pm::SjnStrategy::create(),
+                                        pm::SrtStrategy::create(),
+                                        pm::WinNtStrategy::create(),
+                                        pm::UnixStrategy::create(),
+                                        pm::LinuxO1Strategy::create(),
+                                        pm::CfsStrategy::create()};
+
+  for (const auto &strategy : strategies) {
+    std::mt19937 random(2020);
+
+    auto state = pm::ProcessesState::initial();
+    generateRequests(strategy, state, 2000, random);
+
+    auto base = state;
+    auto requests = generateRequests(strategy, state, 1000, random);
+    auto staticStrategy = pm::toStaticStrategy(strategy);
+
+    BENCHMARK_ADVANCED(strategy->toString() +
+                       ": 1000 заявок, виртуальные вызовы (StrategyPtr)")
+    (Catch::Benchmark::Chronometer meter) {
+      vector<pm::ProcessesState> states(meter.runs(), base);
+      meter.measure([&](int run) {
+        for (const auto &request : requests) {
+          states[run] =
+              strategy->processRequest(request, std::move(states[run]));
+        }
+        return states[run].processes.size();
+      });
+    };
+
+    BENCHMARK_ADVANCED(strategy->toString() +
+                       ": 1000 заявок, статическая диспетчеризация")
+    (Catch::Benchmark::Chronometer meter) {
+      vector<pm::ProcessesState> states(meter.runs(), base);
+      meter.measure([&](int run) {
+        for (const auto &request : requests) {
+          states[run] = pm::dispatchRequest(
+              staticStrategy, request, std::move(states[run]));
+        }
+        return states[run].processes.size();
+      });
+    };
+  }
+}
@@ -43,7 +43,10 @@ static const QString NO_ACTIONS("\n<нет>");
 MemoryTask::MemoryTask(const Models::MemoryModel &model, QWidget *parent)
     : QWidget(parent), _model(model), currentRequest(model.task.completed()),
       currentActions(""), actions(model.task.completed(), ""),
-      states(model.task.requests().size()), ui(new Ui::MemoryTask) {
+      replay(model.task.strategy(),
+             model.task.requests(),
+             MemoryState::initial(model.task.state().config)),
+      ui(new Ui::MemoryTask) {
   ui->setupUi(this);
 
   auto font = QApplication::font();
@@ -81,14 +84,6 @@ MemoryTask::MemoryTask(const Models::MemoryModel &model, QWidget *parent)
           this,
           &MemoryTask::updateCurrentRequest);
 
-  auto state = MemoryState::initial();
-  auto strategy = _model.task.strategy();
-  for (size_t i = 0; i < _model.task.completed(); ++i) {
-    auto request = _model.task.requests().at(i);
-    state = strategy->processRequest(request, state);
-    states[i] = state;
-  }
-
   for (size_t i = 0; i < _model.task.completed(); ++i) {
     QString action;
     if (i < _model.task.actions().size()) {
@@ -205,7 +200,6 @@ void MemoryTask::nextRequest() {
   if (auto [ok, task] = _model.task.next(_model.state); ok) {
     _model.task = task;
     _model.state = _model.task.state();
-    states[currentRequest] = _model.state;
 
     if (_model.task.done()) {
       QMessageBox::information(
@@ -230,7 +224,7 @@ void MemoryTask::refresh() {
                      : _model.task.requests().at(currentRequest);
   auto state = currentRequest == _model.task.completed()
                    ? _model.state
-                   : states[currentRequest];
+                   : replay.state(currentRequest + 1);
   auto strategy = _model.task.strategy();
 
   updateMainView(state, request);
@@ -268,7 +262,7 @@ MemoryState MemoryTask::collectState() {
     freeBlocks.push_back(item->block());
   }
 
-  return {blocks, freeBlocks};
+  return {blocks, freeBlocks, _model.state.config};
 }
 
 void MemoryTask::provideContextMenu(const QPoint &pos) {
@@ -304,7 +298,7 @@ void MemoryTask::provideContextMenu(const QPoint &pos) {
 
 void MemoryTask::updateMainView(const MemoryState &state,
                                 const Request &request) {
-  auto [blocks, freeBlocks] = state;
+  auto [blocks, freeBlocks, config] = state;
   setMemoryBlocks(blocks);
   setFreeMemoryBlocks(freeBlocks);
   setRequest(request);
@@ -334,6 +328,12 @@ void MemoryTask::updateStrategyView(StrategyType type) {
     label->setText("Стратегия: наиболее подходящий");
   } else if (type == StrategyType::LEAST_APPROPRIATE) {
     label->setText("Стратегия: наименее подходящий");
+  } else if (type == StrategyType::BUDDY) {
+    label->setText("Стратегия: система двойников");
+  } else if (type == StrategyType::TLSF) {
+    label->setText("Стратегия: TLSF");
+  } else if (type == StrategyType::NEXT_APPROPRIATE) {
+    label->setText("Стратегия: следующий подходящий");
   }
 }
 
@@ -12,6 +12,7 @@
 #include <algo/memory/requests.h>
 #include <algo/memory/strategies.h>
 #include <algo/memory/types.h>
+#include <utils/replay.h>
 #include <utils/tasks.h>
 
 #include "models.h"
@@ -43,7 +44,7 @@ private:
 
   std::vector<QString> actions;
 
-  std::vector<MemoryManagement::MemoryState> states;
+  Utils::MemoryReplayCache replay;
 
   void processActionAllocate(const MemoryManagement::MemoryBlock &block,
                              uint32_t blockIndex);
@@ -51,7 +51,10 @@ ProcessesTask::ProcessesTask(const Models::ProcessesModel &model,
     : QWidget(parent), _model(model), currentRequest(model.task.completed()),
 
       currentActions(""), actions(model.task.completed(), ""),
-      states(model.task.requests().size()), ui(new Ui::ProcessesTask) {
+      replay(model.task.strategy(),
+             model.task.requests(),
+             ProcessesState::initial(model.task.state().config)),
+      ui(new Ui::ProcessesTask) {
   ui->setupUi(this);
 
   auto font = QApplication::font();
@@ -60,19 +63,14 @@ ProcessesTask::ProcessesTask(const Models::ProcessesModel &model,
 
   ui->processesTable->setContextMenuPolicy(Qt::CustomContextMenu);
 
-  ui->lineEditQueue1Push->setValidator(new QIntValidator(0, 255));
-  ui->lineEditQueue2Push->setValidator(new QIntValidator(0, 255));
+  const auto &config = _model.task.state().config;
+  ui->lineEditQueue1Push->setValidator(new QIntValidator(0, config.maxPid()));
+  ui->lineEditQueue2Push->setValidator(new QIntValidator(0, config.maxPid()));
+  ui->spinBoxQueue1->setMaximum(config.priorities() - 1);
+  ui->spinBoxQueue2->setMaximum(config.priorities() - 1);
 
   setupSignals();
 
-  auto state = ProcessesState::initial();
-  auto strategy = _model.task.strategy();
-  for (size_t i = 0; i < _model.task.completed(); ++i) {
-    auto request = _model.task.requests().at(i);
-    state = strategy->processRequest(request, state);
-    states[i] = state;
-  }
-
   for (size_t i = 0; i < _model.task.completed(); ++i) {
     QString action;
     if (i < _model.task.actions().size()) {
@@ -115,6 +113,7 @@ void ProcessesTask::processActionCreate() {
       {StrategyType::SJN, {Field::Pid, Field::Ppid, Field::WorkTime}},
       {StrategyType::SRT, {Field::Pid, Field::Ppid, Field::WorkTime}},
       {StrategyType::UNIX, {Field::Pid, Field::Ppid, Field::Priority}},
+      {StrategyType::CFS, {Field::Pid, Field::Ppid, Field::Priority}},
       {StrategyType::WINDOWS,
        {Field::Pid, Field::Ppid, Field::Priority, Field::BasePriority}}};
 
@@ -197,7 +196,7 @@ void ProcessesTask::processActionDecrease(std::size_t index) {
     auto &process = _model.state.processes.at(index);
     auto pid = process.pid();
     if (process.priority() > 0) {
-      process = process.priority(process.priority() - 1);
+      process = process.priority(process.priority() - 1, _model.state.config);
     }
     currentActions += "\nУменьшение приоритета PID=%1 на 1"_qs.arg(pid);
     refresh();
@@ -284,7 +283,7 @@ void ProcessesTask::refresh() {
                      : _model.task.requests().at(currentRequest);
   auto state = currentRequest == _model.task.completed()
                    ? _model.state
-                   : states[currentRequest];
+                   : replay.state(currentRequest + 1);
   auto strategy = _model.task.strategy();
 
   updateMainView(state, request);
@@ -301,7 +300,6 @@ void ProcessesTask::nextRequest() {
   if (auto [ok, task] = _model.task.next(state); ok) {
     _model.task = task;
     _model.state = _model.task.state();
-    states[currentRequest] = _model.state;
 
     if (_model.task.done()) {
       QMessageBox::information(
@@ -409,7 +407,7 @@ ProcessesState ProcessesTask::collectState() {
     queues[queue1Index][i] = ui->listQueue1->item(itemIndex)->text().toInt();
   }
 
-  return {processes, queues};
+  return {processes, queues, _model.state.config};
 }
 
 void ProcessesTask::provideContextMenu(const QPoint &pos) {
@@ -476,7 +474,7 @@ std::size_t ProcessesTask::mapRowToIndex(int row) {
 
 void ProcessesTask::updateMainView(const ProcessesState &state,
                                    const Request &request) {
-  auto [processes, queues] = state;
+  const auto &[processes, queues] = state;
   setProcessesList(processes);
   setQueuesLists(queues);
   setRequest(request);
@@ -499,7 +497,8 @@ void ProcessesTask::updateStrategyView(StrategyType type) {
       {StrategyType::SRT, "Стратегия: SRT"_qs},
       {StrategyType::WINDOWS, "Стратегия: Windows NT"_qs},
       {StrategyType::UNIX, "Стратегия: Unix"_qs},
-      {StrategyType::LINUXO1, "Стратегия: Linux O(1)"}};
+      {StrategyType::LINUXO1, "Стратегия: Linux O(1)"},
+      {StrategyType::CFS, "Стратегия: CFS"_qs}};
 
   label->setText(strategyMap[type]);
 }
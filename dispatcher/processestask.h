@@ -13,6 +13,7 @@
 
 #include <algo/processes/strategies.h>
 #include <algo/processes/types.h>
+#include <utils/replay.h>
 #include <utils/tasks.h>
 
 #include <processestablewidget.h>
@@ -50,7 +51,7 @@ private:
 
   std::vector<QString> actions;
 
-  std::vector<ProcessesManagement::ProcessesState> states;
+  Utils::ProcessesReplayCache replay;
 
   void processActionCreate();
 
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <algorithm>
 #include <cstddef>
 #include <cstdint>
 #include <functional>
@@ -35,13 +36,16 @@ inline StrategyPtr randStrategy() {
   vector<MemoryManagement::StrategyPtr> strategies = {
       MemoryManagement::FirstAppropriateStrategy::create(),
       MemoryManagement::MostAppropriateStrategy::create(),
-      MemoryManagement::LeastAppropriateStrategy::create()};
+      MemoryManagement::LeastAppropriateStrategy::create(),
+      MemoryManagement::BuddyStrategy::create(),
+      MemoryManagement::TlsfStrategy::create(),
+      MemoryManagement::NextAppropriateStrategy::create()};
 
   return RandUtils::randChoice(strategies);
 }
 
 inline set<int32_t> getAvailablePids(const MemoryState &state) {
-  auto [blocks, freeBlocks] = state;
+  auto [blocks, freeBlocks, config] = state;
   set<int32_t> existingPids, availablePids;
   for (const auto &block : blocks) {
     if (block.pid() != -1) {
@@ -57,7 +61,7 @@ inline set<int32_t> getAvailablePids(const MemoryState &state) {
 }
 
 inline set<int32_t> getUsedPids(const MemoryState &state) {
-  auto [blocks, freeBlocks] = state;
+  auto [blocks, freeBlocks, config] = state;
   set<int32_t> usedPids;
   for (const auto &block : blocks) {
     if (block.pid() != -1) {
@@ -67,36 +71,62 @@ inline set<int32_t> getUsedPids(const MemoryState &state) {
   return usedPids;
 }
 
+/**
+ *  Возвращает наибольшее количество страниц, которое стратегия @a type может
+ *  выделить процессу одним блоком.
+ */
+inline int32_t availablePages(const MemoryState &state, StrategyType type) {
+  int32_t total = 0, largest = 0;
+  for (const auto &block : state.freeBlocks) {
+    total += block.size();
+
+    // наибольший блок системы двойников внутри свободного блока
+    auto end = block.address() + block.size();
+    for (auto address = block.address(); address < end;) {
+      int32_t piece = 1;
+      while (piece <= (end - address) / 2 && address % (piece * 2) == 0) {
+        piece *= 2;
+      }
+      largest = std::max(largest, piece);
+      address += piece;
+    }
+  }
+
+  // стратегия "Система двойников" не выполняет дефрагментацию
+  return type == StrategyType::BUDDY ? largest : total;
+}
+
 // <pages, bytes>
-inline std::pair<int32_t, int32_t> genRequestedMemory(int32_t availablePages) {
-  int32_t pages = RandUtils::randRange(1, availablePages);
-  int32_t min = (pages - 1) * 4096 + 1;
-  int32_t max = pages * 4096;
+inline std::pair<int32_t, int64_t>
+genRequestedMemory(int32_t availablePages, const MemoryConfig &config) {
+  int32_t pages = RandUtils::randRange(1, std::max(availablePages, 1));
+  int64_t min = static_cast<int64_t>(pages - 1) * config.pageSize() + 1;
+  int64_t max = static_cast<int64_t>(pages) * config.pageSize();
   return {pages, RandUtils::randRange(min, max)};
 }
 
-inline optional<Request> genCreateProcess(const MemoryState &state,
-                                          bool valid = true) {
+inline optional<Request>
+genCreateProcess(const MemoryState &state,
+                 bool valid = true,
+                 StrategyType type = StrategyType::FIRST_APPROPRIATE) {
   using namespace RandUtils;
 
-  auto [blocks, freeBlocks] = state;
+  auto [blocks, freeBlocks, config] = state;
   auto usedPids = getUsedPids(state), availablePids = getAvailablePids(state);
 
-  int32_t freePages = 0;
-  for (const auto &block : freeBlocks) {
-    freePages += block.size();
-  }
+  auto freePages = availablePages(state, type);
 
   if (valid && !availablePids.empty() && freePages > 0) {
-    auto [pages, bytes] = genRequestedMemory(freePages);
+    auto [pages, bytes] = genRequestedMemory(freePages, config);
     auto newPid = randChoice(availablePids);
 
-    return CreateProcessReq(newPid, bytes);
+    return CreateProcessReq(newPid, bytes, config);
   } else if (!valid && !usedPids.empty()) {
-    auto [pages, bytes] = genRequestedMemory(randRange(1, 255));
+    auto [pages, bytes] =
+        genRequestedMemory(randRange(1, config.pages() - 1), config);
     auto newPid = randChoice(usedPids);
 
-    return CreateProcessReq(newPid, bytes);
+    return CreateProcessReq(newPid, bytes, config);
   } else {
     return tl::nullopt;
   }
@@ -118,34 +148,35 @@ inline optional<Request> genTerminateProcess(const MemoryState &state,
   }
 }
 
-inline optional<Request> genAllocateMemory(const MemoryState &state,
-                                           bool valid = true) {
+inline optional<Request>
+genAllocateMemory(const MemoryState &state,
+                  bool valid = true,
+                  StrategyType type = StrategyType::FIRST_APPROPRIATE) {
   using namespace RandUtils;
 
-  auto [blocks, freeBlocks] = state;
+  auto [blocks, freeBlocks, config] = state;
   auto usedPids = getUsedPids(state), availablePids = getAvailablePids(state);
 
-  int32_t freePages = 0;
-  for (const auto &block : freeBlocks) {
-    freePages += block.size();
-  }
+  auto freePages = availablePages(state, type);
 
   if (valid && !usedPids.empty() && freePages > 0) {
-    auto [pages, bytes] = genRequestedMemory(freePages);
+    auto [pages, bytes] = genRequestedMemory(freePages, config);
     auto newPid = randChoice(usedPids);
 
-    return AllocateMemory(newPid, bytes);
+    return AllocateMemory(newPid, bytes, config);
   } else if (!valid) {
     if (!availablePids.empty()) {
-      auto [pages, bytes] = genRequestedMemory(randRange(1, 255));
+      auto [pages, bytes] =
+          genRequestedMemory(randRange(1, config.pages() - 1), config);
       auto newPid = randChoice(availablePids);
 
-      return AllocateMemory(newPid, bytes);
-    } else if (!usedPids.empty() && freePages < 255) {
-      auto [pages, bytes] = genRequestedMemory(randRange(freePages, 255));
+      return AllocateMemory(newPid, bytes, config);
+    } else if (!usedPids.empty() && freePages < config.pages() - 1) {
+      auto [pages, bytes] = genRequestedMemory(
+          randRange(freePages, config.pages() - 1), config);
       auto newPid = randChoice(usedPids);
 
-      return AllocateMemory(newPid, bytes);
+      return AllocateMemory(newPid, bytes, config);
     } else {
       return tl::nullopt;
     }
@@ -158,7 +189,7 @@ inline optional<Request> genFreeMemory(const MemoryState &state,
                                        bool valid = true) {
   using namespace RandUtils;
 
-  auto [blocks, freeBlocks] = state;
+  auto [blocks, freeBlocks, config] = state;
   auto usedPids = getUsedPids(state), availablePids = getAvailablePids(state);
 
   std::map<int32_t, size_t> blocksCount;
@@ -180,37 +211,47 @@ inline optional<Request> genFreeMemory(const MemoryState &state,
   if (valid && !usedBlocks.empty()) {
     auto block = randChoice(usedBlocks);
 
-    return FreeMemory(block.pid(), block.address());
+    return FreeMemory(block.pid(), block.address(), config);
   } else {
     if (!usedBlocks.empty()) {
       auto block = randChoice(usedBlocks);
       auto delta = randRange(1, 255);
       auto newPid = (block.pid() + delta) % maxPid();
 
-      return FreeMemory(newPid, block.address());
+      return FreeMemory(newPid, block.address(), config);
     } else {
       auto pid = randRange(0, maxPid());
-      auto address = randRange(0, 255);
+      auto address = randRange(0, config.pages() - 1);
 
-      return FreeMemory(pid, address);
+      return FreeMemory(pid, address, config);
     }
   }
 }
 } // namespace Generators::MemoryTask::Details
 
 namespace Generators::MemoryTask {
-inline Utils::MemoryTask generate(uint32_t requestCount = 40) {
+inline Utils::MemoryTask
+generate(uint32_t requestCount = 40,
+         const MemoryManagement::MemoryConfig &config =
+             MemoryManagement::MemoryConfig()) {
   using namespace Details;
   using namespace RandUtils;
   using GenPtr = std::function<optional<Request>(const MemoryState &, bool)>;
 
-  vector<GenPtr> gens = {&Details::genCreateProcess,
-                         &Details::genTerminateProcess,
-                         &Details::genAllocateMemory,
-                         &Details::genFreeMemory};
-
   auto strategy = randStrategy();
-  auto state = MemoryState::initial();
+  auto type = strategy->type;
+
+  vector<GenPtr> gens = {
+      [type](const MemoryState &state, bool valid) {
+        return genCreateProcess(state, valid, type);
+      },
+      &Details::genTerminateProcess,
+      [type](const MemoryState &state, bool valid) {
+        return genAllocateMemory(state, valid, type);
+      },
+      &Details::genFreeMemory};
+
+  auto state = MemoryState::initial(config);
   vector<Request> requests;
 
   for (uint32_t i = 0; i < requestCount; ++i) {
@@ -241,6 +282,6 @@ inline Utils::MemoryTask generate(uint32_t requestCount = 40) {
     state = strategy->processRequest(requests.back(), state);
   }
   return Utils::MemoryTask::create(
-      strategy, 0, MemoryState::initial(), requests);
+      strategy, 0, MemoryState::initial(config), requests);
 }
 } // namespace Generators::MemoryTask
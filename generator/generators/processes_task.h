@@ -33,7 +33,8 @@ inline pair<StrategyPtr, GeneratorPtr> randStrategy(bool preemptive = false) {
         {RoundRobinStrategy::create(), make_shared<RoundRobinTaskGenerator>()},
         {WinNtStrategy::create(), make_shared<WinNtTaskGenerator>()},
         {UnixStrategy::create(), make_shared<UnixTaskGenerator>()},
-        {LinuxO1Strategy::create(), make_shared<LinuxO1TaskGenerator>()}};
+        {LinuxO1Strategy::create(), make_shared<LinuxO1TaskGenerator>()},
+        {CfsStrategy::create(), make_shared<CfsTaskGenerator>()}};
   } else {
     strategies = {{FcfsStrategy::create(), make_shared<FcfsTaskGenerator>()},
                   {SjnStrategy::create(), make_shared<SjnTaskGenerator>()},
@@ -45,8 +46,11 @@ inline pair<StrategyPtr, GeneratorPtr> randStrategy(bool preemptive = false) {
 } // namespace Generators::ProcessesTask::Details
 
 namespace Generators::ProcessesTask {
-inline Utils::ProcessesTask generate(uint32_t requestCount = 40,
-                                     bool preemptive = false) {
+inline Utils::ProcessesTask
+generate(uint32_t requestCount = 40,
+         bool preemptive = false,
+         const ProcessesManagement::ProcessesConfig &config =
+             ProcessesManagement::ProcessesConfig()) {
   using namespace Details;
   using namespace ProcessesManagement;
   using namespace RandUtils;
@@ -54,7 +58,7 @@ inline Utils::ProcessesTask generate(uint32_t requestCount = 40,
   using tl::nullopt;
   using tl::optional;
 
-  const auto initialState = ProcessesState::initial();
+  const auto initialState = ProcessesState::initial(config);
 
   auto [strategy, generator] = randStrategy(preemptive);
   auto [state, requests] = generator->bootstrap(initialState, strategy);
@@ -81,7 +85,7 @@ inline Utils::ProcessesTask generate(uint32_t requestCount = 40,
       requests.push_back(randChoice(invalidRequests));
     }
 
-    state = strategy->processRequest(requests.back(), state);
+    state = strategy->processRequest(requests.back(), std::move(state));
   }
 
   if (requests.size() > requestCount) {
@@ -2,6 +2,7 @@
 
 #include <algorithm>
 #include <cstdint>
+#include <functional>
 #include <iterator>
 #include <set>
 #include <tuple>
@@ -16,6 +17,7 @@
 #include <algo/processes/requests.h>
 #include <algo/processes/strategies.h>
 #include <algo/processes/types.h>
+#include <algo/processes/views.h>
 
 #include "../rand_utils.h"
 
@@ -189,7 +191,7 @@ public:
 
   Stats collectStats(const ProcessesState &state) const {
     int active = 0, waiting = 0, executing = 0;
-    for (const auto &process : state.processes) {
+    for (const auto &process : StateView(state).processes()) {
       if (process.state() == ProcState::ACTIVE) {
         active++;
       } else if (process.state() == ProcState::WAITING) {
@@ -252,7 +254,7 @@ public:
     for (const auto &genFn : genFns) {
       if (auto opt = genFn(state); opt.has_value()) {
         requests.push_back(*opt);
-        state = strategy->processRequest(*opt, state);
+        state = strategy->processRequest(*opt, std::move(state));
       }
     }
 
@@ -261,7 +263,6 @@ public:
 
   virtual optional<Request> CreateProcessReq(const ProcessesState &state,
                                              bool valid = true) const {
-    auto [processes, queues] = state;
     auto usedPids = getUsedPids(state);
     auto availablePids = getAvailablePids(state);
 
@@ -271,17 +272,20 @@ public:
 
       // 3 из 5 заявок - дочерний процесс (если возможно)
       if (RandUtils::randRange(0, 256) % 5 < 2) {
-        return ProcessesManagement::CreateProcessReq(pid, ppid);
+        return ProcessesManagement::CreateProcessReq(
+            pid, ppid, 0, 0, 0, 0, state.config);
       } else {
         usedPids.insert(-1);
-        auto parentIndex = getIndexByState(processes, ProcState::EXECUTING);
-        ppid = parentIndex ? processes.at(*parentIndex).pid() : -1;
+        auto parent = StateView(state).current();
+        ppid = parent ? parent->pid() : -1;
 
-        return ProcessesManagement::CreateProcessReq(pid, ppid);
+        return ProcessesManagement::CreateProcessReq(
+            pid, ppid, 0, 0, 0, 0, state.config);
       }
     } else if (!valid && !usedPids.empty()) {
       auto pid = RandUtils::randChoice(usedPids);
-      return ProcessesManagement::CreateProcessReq(pid);
+      return ProcessesManagement::CreateProcessReq(
+          pid, -1, 0, 0, 0, 0, state.config);
     } else {
       return nullopt;
     }
@@ -294,10 +298,10 @@ public:
 
     if (valid && !usedPids.empty()) {
       auto pid = RandUtils::randChoice(usedPids);
-      return ProcessesManagement::TerminateProcessReq(pid);
+      return ProcessesManagement::TerminateProcessReq(pid, state.config);
     } else if (!valid && !availablePids.empty()) {
       auto pid = RandUtils::randChoice(availablePids);
-      return ProcessesManagement::TerminateProcessReq(pid);
+      return ProcessesManagement::TerminateProcessReq(pid, state.config);
     } else {
       return nullopt;
     }
@@ -305,22 +309,21 @@ public:
 
   virtual optional<Request> InitIO(const ProcessesState &state,
                                    bool valid = true) const {
-    auto [processes, queues] = state;
     auto usedPids = getUsedPids(state);
 
-    auto currentIndex = getIndexByState(processes, ProcState::EXECUTING);
-    if (currentIndex) {
-      usedPids.erase(processes.at(*currentIndex).pid());
+    auto current = StateView(state).current();
+    if (current) {
+      usedPids.erase(current->pid());
     }
 
-    if (valid && currentIndex &&
+    if (valid && current &&
         !usedPids.empty()) { // хотя бы один процесс должен исполняться на
                              // процессоре
-      auto pid = processes.at(*currentIndex).pid();
-      return ProcessesManagement::InitIO(pid);
+      auto pid = current->pid();
+      return ProcessesManagement::InitIO(pid, state.config);
     } else if (!valid && !usedPids.empty()) {
       auto pid = RandUtils::randChoice(usedPids);
-      return ProcessesManagement::InitIO(pid);
+      return ProcessesManagement::InitIO(pid, state.config);
     } else {
       return nullopt;
     }
@@ -328,9 +331,8 @@ public:
 
   virtual optional<Request> TerminateIO(const ProcessesState &state,
                                         bool valid = true) const {
-    auto [processes, queues] = state;
     set<int32_t> waitingPids, otherPids;
-    for (const auto &process : processes) {
+    for (const auto &process : StateView(state).processes()) {
       if (process.state() == ProcState::WAITING) {
         waitingPids.insert(process.pid());
       }
@@ -342,10 +344,10 @@ public:
 
     if (valid && !waitingPids.empty()) {
       auto pid = RandUtils::randChoice(waitingPids);
-      return ProcessesManagement::TerminateIO(pid);
+      return ProcessesManagement::TerminateIO(pid, 1, state.config);
     } else if (!valid && !otherPids.empty()) {
       auto pid = RandUtils::randChoice(otherPids);
-      return ProcessesManagement::TerminateIO(pid);
+      return ProcessesManagement::TerminateIO(pid, 1, state.config);
     } else {
       return nullopt;
     }
@@ -353,20 +355,19 @@ public:
 
   virtual optional<Request> TransferControl(const ProcessesState &state,
                                             bool valid = true) const {
-    auto [processes, queues] = state;
     auto usedPids = getUsedPids(state);
 
-    auto currentIndex = getIndexByState(processes, ProcState::EXECUTING);
-    if (currentIndex) {
-      usedPids.erase(processes.at(*currentIndex).pid());
+    auto current = StateView(state).current();
+    if (current) {
+      usedPids.erase(current->pid());
     }
 
-    if (valid && currentIndex) {
-      auto pid = processes.at(*currentIndex).pid();
-      return ProcessesManagement::TransferControl(pid);
+    if (valid && current) {
+      auto pid = current->pid();
+      return ProcessesManagement::TransferControl(pid, state.config);
     } else if (!valid && !usedPids.empty()) {
       auto pid = RandUtils::randChoice(usedPids);
-      return ProcessesManagement::TransferControl(pid);
+      return ProcessesManagement::TransferControl(pid, state.config);
     } else {
       return nullopt;
     }
@@ -378,15 +379,39 @@ public:
   }
 
 protected:
-  constexpr int32_t maxPid() const { return 24; }
+  /**
+   *  Количество PID, из которых выбираются идентификаторы новых процессов.
+   */
+  static constexpr int32_t PID_POOL_SIZE = 24;
+
+  /**
+   *  @brief Возвращает наибольший приоритет, назначаемый новым процессам.
+   *
+   *  Для 16 уровней приоритета - 11, для других конфигураций значение
+   *  масштабируется пропорционально количеству уровней.
+   *
+   *  @param state Дескриптор состояния процессов.
+   */
+  size_t maxCreatedPriority(const ProcessesState &state) const {
+    return state.config.maxPriority() * 11 / 15;
+  }
 
+  /**
+   *  @brief Возвращает PID, не занятые существующими процессами.
+   *
+   *  Идентификаторы выбираются из PID_POOL_SIZE значений, равномерно
+   *  распределенных по диапазону PID (для 256 PID и меньше - от 0 до 23).
+   *
+   *  @param state Дескриптор состояния процессов.
+   */
   set<int32_t> getAvailablePids(const ProcessesState &state) const {
-    set<int32_t> existingPids, availabePids;
-    for (const auto &process : state.processes) {
-      existingPids.insert(process.pid());
-    }
-    for (int32_t pid = 0; pid < maxPid(); ++pid) {
-      if (auto p = existingPids.find(pid); p == existingPids.end()) {
+    const auto &config = state.config;
+    auto stride = std::max(1, config.pids() / ProcessesConfig::DEFAULT_PIDS);
+    auto count = std::min(PID_POOL_SIZE, config.pids() / stride);
+
+    set<int32_t> availabePids;
+    for (int32_t i = 0; i < count; ++i) {
+      if (auto pid = i * stride; !state.indexOf(pid).has_value()) {
         availabePids.insert(pid);
       }
     }
@@ -395,7 +420,7 @@ protected:
 
   set<int32_t> getUsedPids(const ProcessesState &state) const {
     set<int32_t> usedPids;
-    for (const auto &process : state.processes) {
+    for (const auto &process : StateView(state).processes()) {
       usedPids.insert(process.pid());
     }
     return usedPids;
@@ -0,0 +1,7 @@
+#pragma once
+
+#include "task_unix_generator.h"
+
+namespace Generators::ProcessesTask::TaskGenerators {
+class CfsTaskGenerator : public UnixTaskGenerator {};
+} // namespace Generators::ProcessesTask::TaskGenerators
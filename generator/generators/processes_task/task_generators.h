@@ -1,6 +1,7 @@
 #pragma once
 
 #include "task_abstract_generator.h"
+#include "task_cfs_generator.h"
 #include "task_fcfs_generator.h"
 #include "task_linuxo1_generator.h"
 #include "task_roundrobin_generator.h"
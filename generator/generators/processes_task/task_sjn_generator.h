@@ -35,7 +35,8 @@ public:
                                                    request.priority(),
                                                    request.basePriority(),
                                                    request.timer(),
-                                                   workTime);
+                                                   workTime,
+                                                   state.config);
     } else {
       return base;
     }
@@ -29,13 +29,15 @@ public:
     if (base) {
       auto request = base->get<ProcessesManagement::CreateProcessReq>();
 
-      auto priority = RandUtils::randRange(0u, 11u);
+      auto maxPriority = maxCreatedPriority(state);
+      auto priority = RandUtils::randRange<size_t>(0, maxPriority);
       return ProcessesManagement::CreateProcessReq(request.pid(),
                                                    request.ppid(),
                                                    priority,
                                                    0,
                                                    request.timer(),
-                                                   request.workTime());
+                                                   request.workTime(),
+                                                   state.config);
     } else {
       return base;
     }
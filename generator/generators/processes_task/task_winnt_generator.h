@@ -1,5 +1,8 @@
 #pragma once
 
+#include <algorithm>
+#include <cstddef>
+
 #include <mapbox/variant.hpp>
 #include <tl/optional.hpp>
 
@@ -29,13 +32,15 @@ public:
     if (base) {
       auto request = base->get<ProcessesManagement::CreateProcessReq>();
 
-      auto priority = RandUtils::randRange(0u, 11u);
+      auto maxPriority = maxCreatedPriority(state);
+      auto priority = RandUtils::randRange<size_t>(0, maxPriority);
       return ProcessesManagement::CreateProcessReq(request.pid(),
                                                    request.ppid(),
                                                    priority,
                                                    priority,
                                                    request.timer(),
-                                                   request.workTime());
+                                                   request.workTime(),
+                                                   state.config);
     } else {
       return base;
     }
@@ -48,8 +53,9 @@ public:
       auto request = base->get<ProcessesManagement::TerminateIO>();
 
       auto pid = request.pid();
-      auto augment = RandUtils::randRange(1u, 3u);
-      return ProcessesManagement::TerminateIO(pid, augment);
+      auto augment = RandUtils::randRange<size_t>(
+          1, std::min<size_t>(3, state.config.maxPriority()));
+      return ProcessesManagement::TerminateIO(pid, augment, state.config);
     } else {
       return base;
     }
@@ -0,0 +1,800 @@
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <set>
+#include <utility>
+#include <vector>
+
+#include <tl/optional.hpp>
+
+#include "engine.h"
+#include "exceptions.h"
+#include "page_bitmap.h"
+#include "tlsf.h"
+#include "types.h"
+
+namespace MemoryManagement {
+/**
+ *  @brief Изменяемое состояние памяти, основанное на битовой карте страниц.
+ *
+ *  Альтернатива MemoryEngine для больших адресных пространств. Вместо списка
+ *  блоков хранятся две битовые карты - занятых страниц и страниц, с которых
+ *  начинаются блоки, - и параллельный им массив владельцев (PID процесса
+ *  хранится в элементе, соответствующем началу блока). Для каждого процесса
+ *  хранится упорядоченное множество начал его блоков. Поиск свободного блока
+ *  просматривает битовую карту занятых страниц словами по 64 страницы, а
+ *  список блоков строится только при вызове state().
+ *
+ *  Просмотр битовой карты ускоряет в первую очередь порядки ADDRESS и ROVING
+ *  (первый подходящий и следующий подходящий блок): поиск останавливается на
+ *  первом достаточно большом свободном блоке. Для порядков по размеру
+ *  (SIZE_ASCENDING, SIZE_DESCENDING, SEGREGATED) отдельного индекса размеров
+ *  нет, поэтому поиск перебирает все свободные блоки памяти; пропускаются
+ *  словами только занятые страницы между ними.
+ *
+ *  Класс предоставляет те же методы, что и MemoryEngine, поэтому стратегии
+ *  обрабатывают заявки над ним без изменений. Ссылкой на блок (BlockHandle)
+ *  служит адрес его начала. Результат каждой операции совпадает с результатом
+ *  одноименной операции MemoryEngine.
+ */
+class BitmapMemoryEngine {
+public:
+  using BlockHandle = int32_t;
+
+private:
+  MemoryConfig _config;
+
+  PageBitmap _used;
+
+  PageBitmap _starts;
+
+  std::vector<int32_t> _owners;
+
+  std::vector<std::set<BlockHandle>> _processBlocks;
+
+  std::vector<BlockHandle> _unordered;
+
+  int32_t _freePages = 0;
+
+  FreeBlocksOrder _order = FreeBlocksOrder::NONE;
+
+  int32_t _rover = 0;
+
+  bool _compressed = false;
+
+  CompactionMode _compaction = CompactionMode::FULL;
+
+  int64_t _pagesMoved = 0;
+
+public:
+  /**
+   *  @brief Создает изменяемое состояние памяти.
+   *
+   *  @param state Дескриптор состояния памяти.
+   *
+   *  @throws MemoryManagement::TypeException Исключение возникает, если блоки
+   *  из @a state.blocks не покрывают адресное пространство без пропусков и
+   *  наложений или какой-либо свободный блок из @a state.freeBlocks
+   *  отсутствует в @a state.blocks.
+   */
+  explicit BitmapMemoryEngine(const MemoryState &state)
+      : _config(state.config),
+        _used(state.config.pages()),
+        _starts(state.config.pages()),
+        _owners(static_cast<size_t>(state.config.pages()), -1),
+        _processBlocks(static_cast<size_t>(MemoryBlock::MAX_PID) + 1) {
+    int32_t address = 0;
+    for (const auto &block : state.blocks) {
+      if (block.address() != address || block.size() > pages() - address) {
+        throw TypeException("INVALID_STATE");
+      }
+
+      _starts.set(address);
+      _owners[address] = block.pid();
+      if (block.pid() != -1) {
+        _used.assign(address, address + block.size(), true);
+        linkBlock(block.pid(), address);
+      } else {
+        _freePages += block.size();
+      }
+      address += block.size();
+    }
+    if (address != pages()) {
+      throw TypeException("INVALID_STATE");
+    }
+
+    for (const auto &freeBlock : state.freeBlocks) {
+      auto handle = findBlock(freeBlock.address());
+      if (!handle.has_value() || !(block(*handle) == freeBlock)) {
+        throw TypeException("INVALID_STATE");
+      }
+      _unordered.push_back(*handle);
+    }
+
+    _compressed = !hasAdjacentFreeBlocks();
+  }
+
+  BitmapMemoryEngine() : BitmapMemoryEngine(MemoryState::initial()) {}
+
+  /**
+   *  Возвращает дескриптор текущего состояния памяти.
+   */
+  MemoryState state() const {
+    std::vector<MemoryBlock> blocks;
+    for (int32_t address = 0; address < pages();) {
+      blocks.push_back(block(address));
+      address += blocks.back().size();
+    }
+    return {std::move(blocks), freeBlocks(), _config};
+  }
+
+  /**
+   *  Возвращает параметры адресного пространства.
+   */
+  const MemoryConfig &config() const { return _config; }
+
+  /**
+   *  Возвращает порядок, в котором хранятся свободные блоки памяти.
+   */
+  FreeBlocksOrder order() const { return _order; }
+
+  /**
+   *  Возвращает true, если в памяти нет соседних свободных блоков.
+   */
+  bool compressed() const { return _compressed; }
+
+  /**
+   *  Возвращает способ уплотнения памяти.
+   */
+  CompactionMode compaction() const { return _compaction; }
+
+  /**
+   *  @brief Задает способ уплотнения памяти.
+   *
+   *  @param mode Способ уплотнения памяти.
+   */
+  void setCompaction(CompactionMode mode) { _compaction = mode; }
+
+  /**
+   *  Возвращает суммарный размер блоков (в страницах), перемещенных при
+   *  уплотнении памяти.
+   */
+  int64_t pagesMoved() const { return _pagesMoved; }
+
+  /**
+   *  @brief Возвращает блок памяти по ссылке на него.
+   *
+   *  @param handle Ссылка на блок памяти.
+   */
+  MemoryBlock block(BlockHandle handle) const {
+    return {_owners[handle], handle, blockEnd(handle) - handle, pages()};
+  }
+
+  /**
+   *  @brief Проверяет, выделены ли процессу какие-либо блоки памяти.
+   *
+   *  @param pid Идентификатор процесса.
+   */
+  bool hasProcess(int32_t pid) const {
+    return pid >= 0 && pid <= MemoryBlock::MAX_PID &&
+           !_processBlocks[pid].empty();
+  }
+
+  /**
+   *  @brief Возвращает блоки памяти, выделенные процессу.
+   *
+   *  @param pid Идентификатор процесса.
+   *
+   *  @return Массив блоков, упорядоченных по начальному адресу.
+   */
+  std::vector<BlockHandle> processBlocks(int32_t pid) const {
+    if (!hasProcess(pid)) {
+      return {};
+    }
+    const auto &blocks = _processBlocks[pid];
+    return {blocks.begin(), blocks.end()};
+  }
+
+  /**
+   *  Возвращает суммарный размер свободных блоков памяти (в страницах).
+   */
+  int32_t totalFree() const { return _freePages; }
+
+  /**
+   *  @brief Ищет блок памяти, начинающийся с заданного адреса.
+   *
+   *  @param address Адрес начала блока памяти.
+   *
+   *  @return Ссылка на блок или tl::nullopt, если такого блока нет.
+   */
+  tl::optional<BlockHandle> findBlock(int32_t address) const {
+    if (address < 0 || address >= pages() || !_starts.test(address)) {
+      return tl::nullopt;
+    }
+    return address;
+  }
+
+  /**
+   *  @brief Возвращает блок памяти, предшествующий заданному.
+   *
+   *  @see MemoryEngine::previousBlock().
+   */
+  tl::optional<BlockHandle> previousBlock(BlockHandle handle) const {
+    if (handle == 0) {
+      return tl::nullopt;
+    }
+    return _starts.findSetBefore(handle);
+  }
+
+  /**
+   *  @brief Возвращает блок памяти, следующий за заданным.
+   *
+   *  @see MemoryEngine::nextBlock().
+   */
+  tl::optional<BlockHandle> nextBlock(BlockHandle handle) const {
+    auto next = blockEnd(handle);
+    if (next == pages()) {
+      return tl::nullopt;
+    }
+    return next;
+  }
+
+  /**
+   *  @brief Ищет блок памяти, выделенный процессу и начинающийся с заданного
+   *  адреса.
+   *
+   *  @param pid Идентификатор процесса.
+   *  @param address Адрес начала блока памяти.
+   *
+   *  @return Ссылка на блок или tl::nullopt, если такого блока нет.
+   */
+  tl::optional<BlockHandle> findProcessBlock(int32_t pid,
+                                             int32_t address) const {
+    auto handle = findBlock(address);
+    if (pid == -1 || !handle.has_value() || _owners[*handle] != pid) {
+      return tl::nullopt;
+    }
+    return handle;
+  }
+
+  /**
+   *  @brief Ищет первый в порядке хранения свободный блок памяти, размер
+   *  которого не меньше @a size.
+   *
+   *  Свободные блоки перебираются по битовой карте занятых страниц в порядке
+   *  возрастания адресов (для порядка ROVING - по кругу, начиная с блока, на
+   *  котором поиск остановился при последнем выделении памяти). Для порядков
+   *  по размеру просматриваются все свободные блоки.
+   *
+   *  @param size Требуемый размер блока памяти.
+   *
+   *  @return Ссылка на блок или tl::nullopt, если подходящего блока нет.
+   */
+  tl::optional<BlockHandle> findFreeBlock(int32_t size) const {
+    if (_order == FreeBlocksOrder::NONE) {
+      for (auto handle : _unordered) {
+        if (blockEnd(handle) - handle >= size) {
+          return handle;
+        }
+      }
+      return tl::nullopt;
+    }
+
+    if (_order == FreeBlocksOrder::ROVING) {
+      if (_freePages == 0) {
+        return tl::nullopt;
+      }
+      auto rover = roverBlock();
+      for (auto address = rover; address < pages();) {
+        auto end = blockEnd(address);
+        if (end - address >= size) {
+          return address;
+        }
+        address = _used.findReset(end);
+      }
+      for (auto address = _used.findReset(0); address < rover;) {
+        auto end = blockEnd(address);
+        if (end - address >= size) {
+          return address;
+        }
+        address = _used.findReset(end);
+      }
+      return tl::nullopt;
+    }
+
+    tl::optional<BlockHandle> found, sameClass;
+    int32_t foundSize = 0, foundClass = 0;
+    auto searchClass = TlsfIndex::searchClassOf(size);
+    for (auto address = _used.findReset(0); address < pages();) {
+      auto end = blockEnd(address);
+      auto blockSize = end - address;
+      if (blockSize >= size) {
+        switch (_order) {
+        case FreeBlocksOrder::SIZE_ASCENDING:
+          if (!found.has_value() || blockSize < foundSize) {
+            found = address;
+            foundSize = blockSize;
+          }
+          // меньшего подходящего блока нет
+          if (blockSize == size) {
+            return found;
+          }
+          break;
+        case FreeBlocksOrder::SIZE_DESCENDING:
+          if (!found.has_value() || blockSize > foundSize) {
+            found = address;
+            foundSize = blockSize;
+          }
+          break;
+        case FreeBlocksOrder::SEGREGATED: {
+          auto index = TlsfIndex::classOf(blockSize);
+          if (index < searchClass) {
+            // блок того же класса, что и size, см. MemoryEngine
+            if (!sameClass.has_value()) {
+              sameClass = address;
+            }
+          } else if (!found.has_value() || index < foundClass) {
+            found = address;
+            foundClass = index;
+          }
+          break;
+        }
+        default:
+          return address;
+        }
+      }
+      address = _used.findReset(end);
+    }
+    return found.has_value() ? found : sameClass;
+  }
+
+  /**
+   *  @brief Операция выделения памяти процессу в заданном блоке памяти.
+   *
+   *  @see MemoryManagement::allocateMemory().
+   */
+  void allocateMemory(BlockHandle handle, int32_t pid, int32_t pages) {
+    auto end = blockEnd(handle);
+    if (_used.test(handle)) {
+      throw OperationException("BLOCK_IS_USED");
+    } else if (end - handle < pages) {
+      throw OperationException("TOO_SMALL");
+    }
+    MemoryBlock::validate(pid, handle, pages, this->pages());
+    if (pid == -1) {
+      throw TypeException("INVALID_PID");
+    }
+
+    eraseFreeBlock(handle);
+    linkBlock(pid, handle);
+    _used.assign(handle, handle + pages, true);
+    _owners[handle] = pid;
+    _freePages -= pages;
+    if (end - handle > pages) {
+      _starts.set(handle + pages);
+      insertFreeBlock(handle + pages);
+    }
+
+    if (_order == FreeBlocksOrder::ROVING) {
+      // см. MemoryEngine::allocateMemory()
+      _rover = handle + pages;
+      if (_freePages != 0) {
+        _rover = roverBlock();
+      }
+    }
+  }
+
+  /**
+   *  @brief Операция освобождения блока памяти, принадлежащего процессу.
+   *
+   *  @see MemoryManagement::freeMemory().
+   */
+  void freeMemory(int32_t pid, BlockHandle handle) {
+    if (pid == -1 || _owners[handle] != pid) {
+      throw OperationException("PID_MISMATCH");
+    }
+
+    if (_order == FreeBlocksOrder::ROVING && _freePages == 0) {
+      _rover = handle;
+    }
+    auto end = blockEnd(handle);
+    _used.assign(handle, end, false);
+    _owners[handle] = -1;
+    _processBlocks[pid].erase(handle);
+    _freePages += end - handle;
+    insertFreeBlock(handle);
+    _compressed = false;
+  }
+
+  /**
+   *  @brief Освобождает блок памяти, принадлежащий процессу, и объединяет его
+   *  с соседними свободными блоками.
+   *
+   *  @see MemoryEngine::releaseMemory().
+   */
+  BlockHandle releaseMemory(int32_t pid, BlockHandle handle) {
+    auto compressed = _compressed;
+    freeMemory(pid, handle);
+    if (!compressed) {
+      return handle;
+    }
+
+    auto start = handle;
+    if (start > 0 && !_used.test(start - 1)) {
+      start = _starts.findSetBefore(start);
+    }
+    auto end = blockEnd(handle);
+    if (start != handle || (end < pages() && !_used.test(end))) {
+      compressMemory(start);
+    }
+
+    _compressed = true;
+    return start;
+  }
+
+  /**
+   *  @brief Операция дефрагментации памяти.
+   *
+   *  @see MemoryManagement::defragmentMemory().
+   */
+  void defragmentMemory() {
+    PageBitmap starts(pages());
+    std::vector<int32_t> owners(static_cast<size_t>(pages()), -1);
+    int32_t address = 0;
+
+    // переносим занятые блоки в начало памяти в порядке возрастания адресов
+    const auto &used = _used.words(), &oldStarts = _starts.words();
+    for (size_t index = 0; index < used.size(); ++index) {
+      for (auto word = used[index] & oldStarts[index]; word != 0;
+           word &= word - 1) {
+        auto block = static_cast<int32_t>(index * PageBitmap::WORD_BITS +
+                                          PageBitmap::lowestBit(word));
+        auto size = blockEnd(block) - block;
+        auto pid = _owners[block];
+        if (block != address) {
+          // адрес перемещенного блока меньше адресов еще не перемещенных
+          _processBlocks[pid].erase(block);
+          _processBlocks[pid].insert(address);
+          _pagesMoved += size;
+        }
+        starts.set(address);
+        owners[address] = pid;
+        address += size;
+      }
+    }
+
+    _used.assign(0, address, true);
+    _used.assign(address, pages(), false);
+    _starts = std::move(starts);
+    _owners = std::move(owners);
+
+    _unordered.clear();
+    if (address < pages()) {
+      _starts.set(address);
+      insertFreeBlock(address);
+    }
+    _compressed = true;
+  }
+
+  /**
+   *  @brief Уплотняет память так, чтобы в ней появился свободный блок, размер
+   *  которого не меньше @a pages.
+   *
+   *  @see MemoryEngine::compactMemory().
+   */
+  void compactMemory(int32_t pages) {
+    if (_compaction == CompactionMode::FULL) {
+      defragmentMemory();
+      return;
+    }
+
+    // пары <начало, конец> свободных блоков
+    std::vector<std::pair<int32_t, int32_t>> freeBlocks;
+    for (auto address = _used.findReset(0); address < this->pages();) {
+      freeBlocks.emplace_back(address, blockEnd(address));
+      address = _used.findReset(freeBlocks.back().second);
+    }
+
+    auto size = [&freeBlocks](size_t index) {
+      return freeBlocks[index].second - freeBlocks[index].first;
+    };
+    tl::optional<std::pair<size_t, size_t>> best;
+    int64_t bestUsed = 0, freeMemory = 0;
+    for (size_t first = 0, last = 0; last < freeBlocks.size(); ++last) {
+      freeMemory += size(last);
+      while (freeMemory - size(first) >= pages) {
+        freeMemory -= size(first);
+        ++first;
+      }
+      if (freeMemory < pages) {
+        continue;
+      }
+      int64_t used =
+          freeBlocks[last].second - freeBlocks[first].first - freeMemory;
+      if (!best.has_value() || used < bestUsed) {
+        best = std::make_pair(first, last);
+        bestUsed = used;
+      }
+    }
+    if (!best.has_value()) {
+      return;
+    }
+
+    auto start = freeBlocks[best->first].first;
+    auto end = freeBlocks[best->second].second;
+    std::vector<std::pair<int32_t, int32_t>> usedBlocks;
+    for (auto block = start; block != end;) {
+      auto next = blockEnd(block);
+      if (_used.test(block)) {
+        usedBlocks.emplace_back(_owners[block], next - block);
+        _processBlocks[_owners[block]].erase(block);
+      } else {
+        eraseFreeBlock(block);
+      }
+      _owners[block] = -1;
+      block = next;
+    }
+
+    // сдвигаем занятые блоки к началу последовательности
+    _starts.assign(start, end, false);
+    auto address = start;
+    for (const auto &[pid, blockSize] : usedBlocks) {
+      _pagesMoved += blockSize;
+      _starts.set(address);
+      _owners[address] = pid;
+      _processBlocks[pid].insert(address);
+      address += blockSize;
+    }
+    _used.assign(start, address, true);
+    _used.assign(address, end, false);
+    _starts.set(address);
+    insertFreeBlock(address);
+  }
+
+  /**
+   *  @brief Операция сжатия памяти.
+   *
+   *  @see MemoryManagement::compressMemory().
+   */
+  void compressMemory(BlockHandle start) {
+    auto last = start;
+    int32_t count = 0;
+    while (last < pages() && !_used.test(last)) {
+      last = blockEnd(last);
+      ++count;
+    }
+
+    if (count < 2) {
+      throw OperationException("SINGLE_BLOCK");
+    }
+
+    for (auto block = start; block != last; block = blockEnd(block)) {
+      eraseFreeBlock(block);
+    }
+    _starts.assign(start + 1, last, false);
+    insertFreeBlock(start);
+  }
+
+  /**
+   *  @brief Делит свободный блок памяти на два свободных блока.
+   *
+   *  @see MemoryEngine::splitFreeBlock().
+   */
+  BlockHandle splitFreeBlock(BlockHandle handle, int32_t size) {
+    if (_used.test(handle)) {
+      throw OperationException("BLOCK_IS_USED");
+    } else if (blockEnd(handle) - handle <= size) {
+      throw OperationException("TOO_SMALL");
+    }
+
+    eraseFreeBlock(handle);
+    insertFreeBlock(handle);
+    _starts.set(handle + size);
+    insertFreeBlock(handle + size);
+    _compressed = false;
+    return handle + size;
+  }
+
+  /**
+   *  @brief Объединяет свободный блок памяти со следующим за ним свободным
+   *  блоком.
+   *
+   *  @see MemoryEngine::mergeFreeBlocks().
+   */
+  void mergeFreeBlocks(BlockHandle handle) {
+    auto next = blockEnd(handle);
+    if (_used.test(handle) || next == pages() || _used.test(next)) {
+      throw OperationException("SINGLE_BLOCK");
+    }
+
+    eraseFreeBlock(handle);
+    eraseFreeBlock(next);
+    _starts.reset(next);
+    insertFreeBlock(handle);
+  }
+
+  /**
+   *  @brief Выполняет сжатие памяти - объединение соседних свободных блоков в
+   *  один.
+   *
+   *  Если порядок свободных блоков определяется их параметрами, то начала
+   *  свободных блоков, которым предшествует свободная страница, сбрасываются
+   *  словами по 64 страницы. Если память уже сжата, то ничего не делает.
+   */
+  void compressAllMemory() {
+    if (_compressed) {
+      return;
+    }
+
+    if (_order == FreeBlocksOrder::NONE) {
+      // объединенные блоки добавляются в конец порядка хранения, поэтому
+      // последовательности свободных блоков объединяются по одной
+      for (int32_t address = 0; address < pages();) {
+        auto next = blockEnd(address);
+        if (!_used.test(address) && next < pages() && !_used.test(next)) {
+          compressMemory(address);
+          next = blockEnd(address);
+        }
+        address = next;
+      }
+    } else {
+      auto &starts = _starts.words();
+      for (size_t index = 0; index < starts.size(); ++index) {
+        starts[index] &= ~mergeableStarts(index);
+      }
+    }
+
+    _compressed = true;
+  }
+
+  /**
+   *  @brief Упорядочивает свободные блоки памяти.
+   *
+   *  Свободные блоки в порядке, отличном от NONE, строятся по битовой карте
+   *  при обращении к ним, поэтому сортировка сводится к смене порядка.
+   *
+   *  @param order Порядок свободных блоков памяти.
+   */
+  void sortFreeBlocks(FreeBlocksOrder order) {
+    if (order == _order) {
+      return;
+    }
+
+    if (order == FreeBlocksOrder::ROVING) {
+      auto blocks = freeBlocks();
+      _rover = blocks.empty() ? 0 : blocks.front().address();
+    }
+    if (order == FreeBlocksOrder::NONE) {
+      for (const auto &block : freeBlocks()) {
+        _unordered.push_back(block.address());
+      }
+    } else {
+      _unordered.clear();
+    }
+    _order = order;
+  }
+
+private:
+  int32_t pages() const { return _config.pages(); }
+
+  /**
+   *  @brief Добавляет блок памяти в множество блоков процесса.
+   *
+   *  @param pid Идентификатор процесса.
+   *  @param handle Ссылка на блок памяти.
+   *
+   *  @throws MemoryManagement::TypeException Исключение возникает, если
+   *  @a pid выходит за границы допустимых значений.
+   */
+  void linkBlock(int32_t pid, BlockHandle handle) {
+    if (pid < 0 || pid > MemoryBlock::MAX_PID) {
+      throw TypeException("INVALID_PID");
+    }
+    _processBlocks[pid].insert(handle);
+  }
+
+  int32_t blockEnd(BlockHandle handle) const {
+    return _starts.findSet(handle + 1);
+  }
+
+  /**
+   *  Возвращает биты слова @a index карты начал блоков, соответствующие
+   *  свободным блокам, которым предшествует свободная страница.
+   */
+  uint64_t mergeableStarts(size_t index) const {
+    const auto &used = _used.words();
+    // бит i - признак занятости страницы, предшествующей странице i; перед
+    // первой страницей памяти считаем страницу занятой
+    auto previous =
+        (used[index] << 1) | (index > 0 ? used[index - 1] >> 63 : 1);
+    return _starts.words()[index] & ~used[index] & ~previous;
+  }
+
+  /**
+   *  Возвращает начало свободного блока, с которого начинается поиск для
+   *  порядка ROVING (см. MemoryEngine). В памяти должны быть свободные
+   *  страницы.
+   */
+  BlockHandle roverBlock() const {
+    if (_rover < pages() && !_used.test(_rover)) {
+      return _starts.findSetBefore(_rover + 1);
+    }
+    auto address = _used.findReset(_rover);
+    return address < pages() ? address : _used.findReset(0);
+  }
+
+  bool hasAdjacentFreeBlocks() const {
+    for (size_t index = 0; index < _starts.words().size(); ++index) {
+      if (mergeableStarts(index) != 0) {
+        return true;
+      }
+    }
+    return false;
+  }
+
+  std::vector<MemoryBlock> freeBlocks() const {
+    std::vector<MemoryBlock> blocks;
+    if (_order == FreeBlocksOrder::NONE) {
+      for (auto handle : _unordered) {
+        blocks.push_back(block(handle));
+      }
+      return blocks;
+    }
+
+    for (auto address = _used.findReset(0); address < pages();) {
+      blocks.push_back(block(address));
+      address = _used.findReset(address + blocks.back().size());
+    }
+    if (_order == FreeBlocksOrder::ADDRESS) {
+      return blocks;
+    }
+    if (_order == FreeBlocksOrder::ROVING) {
+      auto rover = roverBlock();
+      std::rotate(blocks.begin(),
+                  std::find_if(blocks.begin(),
+                               blocks.end(),
+                               [rover](const MemoryBlock &block) {
+                                 return block.address() == rover;
+                               }),
+                  blocks.end());
+      return blocks;
+    }
+
+    auto order = _order;
+    std::stable_sort(blocks.begin(),
+                     blocks.end(),
+                     [order](const MemoryBlock &lhs, const MemoryBlock &rhs) {
+                       switch (order) {
+                       case FreeBlocksOrder::SIZE_ASCENDING:
+                         return lhs.size() < rhs.size();
+                       case FreeBlocksOrder::SIZE_DESCENDING:
+                         return lhs.size() > rhs.size();
+                       case FreeBlocksOrder::SEGREGATED:
+                         return TlsfIndex::classOf(lhs.size()) <
+                                TlsfIndex::classOf(rhs.size());
+                       default:
+                         return lhs.address() < rhs.address();
+                       }
+                     });
+    return blocks;
+  }
+
+  void insertFreeBlock(BlockHandle handle) {
+    if (_order == FreeBlocksOrder::NONE) {
+      _unordered.push_back(handle);
+    }
+  }
+
+  void eraseFreeBlock(BlockHandle handle) {
+    if (_order != FreeBlocksOrder::NONE) {
+      return;
+    }
+
+    auto pos = std::find(_unordered.begin(), _unordered.end(), handle);
+    if (pos != _unordered.end()) {
+      _unordered.erase(pos);
+    }
+  }
+};
+} // namespace MemoryManagement
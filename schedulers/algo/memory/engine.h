@@ -0,0 +1,854 @@
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <iterator>
+#include <limits>
+#include <list>
+#include <map>
+#include <utility>
+#include <vector>
+
+#include <tl/optional.hpp>
+
+#include "exceptions.h"
+#include "tlsf.h"
+#include "types.h"
+
+namespace MemoryManagement {
+/**
+ *  @brief Порядок, в котором хранятся свободные блоки памяти.
+ *
+ *  NONE - порядок, в котором блоки были переданы в дескрипторе состояния
+ *  памяти или добавлены операциями (новые блоки добавляются в конец);
+ *  ADDRESS - по начальному адресу в порядке возрастания;
+ *  SIZE_ASCENDING - по размеру в порядке возрастания, а затем по начальному
+ *  адресу в порядке возрастания;
+ *  SIZE_DESCENDING - по размеру в порядке убывания, а затем по начальному
+ *  адресу в порядке возрастания;
+ *  SEGREGATED - по классу размера TLSF (см. TlsfIndex) в порядке возрастания,
+ *  а затем по начальному адресу в порядке возрастания;
+ *  ROVING - по начальному адресу в порядке возрастания по кругу, начиная с
+ *  блока, на котором остановился поиск при последнем выделении памяти
+ *  (первый блок в дескрипторе состояния памяти).
+ */
+enum class FreeBlocksOrder {
+  NONE,
+  ADDRESS,
+  SIZE_ASCENDING,
+  SIZE_DESCENDING,
+  SEGREGATED,
+  ROVING
+};
+
+/**
+ *  @brief Способ уплотнения памяти, если ни один свободный блок не вмещает
+ *  запрошенную память.
+ *
+ *  FULL - дефрагментация всей памяти (см. defragmentMemory());
+ *  MINIMAL - сдвиг минимального числа страниц, достаточный для получения
+ *  свободного блока нужного размера (см. MemoryEngine::compactMemory()).
+ */
+enum class CompactionMode { FULL, MINIMAL };
+
+/**
+ *  @brief Изменяемое состояние памяти.
+ *
+ *  Операции из operations.h на каждом шаге копируют дескриптор состояния
+ *  памяти и возвращают новый. Методы данного класса выполняют те же операции
+ *  над одним состоянием на месте, что позволяет обрабатывать длинные
+ *  последовательности заявок без лишних копирований.
+ *
+ *  Блоки памяти хранятся в списке, поэтому ссылка на блок (BlockHandle)
+ *  остается действительной до тех пор, пока блок не будет удален. Свободные
+ *  блоки дополнительно хранятся в упорядоченном индексе, который поддерживает
+ *  заданный стратегией порядок при каждом изменении, поэтому повторная
+ *  сортировка не требуется, а поиск подходящего блока для стратегий "Наиболее
+ *  подходящий" и "Наименее подходящий" выполняется за O(log n). Для каждого
+ *  процесса хранится индекс выделенных ему блоков, поэтому завершение процесса
+ *  и проверка его существования не требуют перебора всех блоков.
+ *
+ *  Результат каждой операции совпадает с результатом одноименной операции из
+ *  operations.h.
+ */
+class MemoryEngine {
+public:
+  using BlockHandle = std::list<MemoryBlock>::const_iterator;
+
+private:
+  using FreeBlockKey = std::pair<int32_t, int32_t>;
+
+  MemoryConfig _config;
+
+  std::list<MemoryBlock> _blocks;
+
+  std::map<FreeBlockKey, BlockHandle> _freeBlocks;
+
+  std::map<int32_t, std::map<int32_t, BlockHandle>> _processBlocks;
+
+  TlsfIndex _segregated;
+
+  FreeBlocksOrder _order = FreeBlocksOrder::NONE;
+
+  int32_t _sequence = 0;
+
+  int32_t _rover = 0;
+
+  bool _compressed = false;
+
+  CompactionMode _compaction = CompactionMode::FULL;
+
+  int64_t _pagesMoved = 0;
+
+public:
+  /**
+   *  @brief Создает изменяемое состояние памяти.
+   *
+   *  @param state Дескриптор состояния памяти.
+   *
+   *  @throws MemoryManagement::TypeException Исключение возникает, если
+   *  какой-либо свободный блок из @a state.freeBlocks отсутствует в
+   *  @a state.blocks.
+   */
+  explicit MemoryEngine(const MemoryState &state)
+      : _config(state.config),
+        _blocks(state.blocks.begin(), state.blocks.end()) {
+    std::map<int32_t, BlockHandle> blocksByAddress;
+    for (auto block = _blocks.cbegin(); block != _blocks.cend(); ++block) {
+      blocksByAddress.emplace(block->address(), block);
+      insertProcessBlock(block);
+    }
+
+    for (const auto &freeBlock : state.freeBlocks) {
+      auto pos = blocksByAddress.find(freeBlock.address());
+      if (pos == blocksByAddress.end() || !(*pos->second == freeBlock)) {
+        throw TypeException("INVALID_STATE");
+      }
+      insertFreeBlock(pos->second);
+    }
+
+    _compressed = !hasAdjacentFreeBlocks();
+  }
+
+  MemoryEngine() : MemoryEngine(MemoryState::initial()) {}
+
+  /**
+   *  @brief Создает копию изменяемого состояния памяти.
+   *
+   *  Индексы хранят ссылки на элементы списка блоков, поэтому они строятся
+   *  заново для списка копии.
+   */
+  MemoryEngine(const MemoryEngine &other) : MemoryEngine(other.state()) {
+    sortFreeBlocks(other._order);
+    _rover = other._rover;
+    _compaction = other._compaction;
+    _pagesMoved = other._pagesMoved;
+  }
+
+  MemoryEngine(MemoryEngine &&other) = default;
+
+  MemoryEngine &operator=(const MemoryEngine &other) {
+    return *this = MemoryEngine(other);
+  }
+
+  MemoryEngine &operator=(MemoryEngine &&other) = default;
+
+  /**
+   *  Возвращает дескриптор текущего состояния памяти.
+   */
+  MemoryState state() const {
+    std::vector<MemoryBlock> blocks(_blocks.begin(), _blocks.end());
+    std::vector<MemoryBlock> freeBlocks;
+    freeBlocks.reserve(_freeBlocks.size());
+    for (const auto &[key, block] : _freeBlocks) {
+      freeBlocks.push_back(*block);
+    }
+    if (_order == FreeBlocksOrder::ROVING && !_freeBlocks.empty()) {
+      std::rotate(freeBlocks.begin(),
+                  freeBlocks.begin() +
+                      std::distance(_freeBlocks.begin(), roverPosition()),
+                  freeBlocks.end());
+    }
+    return {std::move(blocks), std::move(freeBlocks), _config};
+  }
+
+  /**
+   *  Возвращает список всех блоков памяти, упорядоченных по начальному адресу.
+   */
+  const std::list<MemoryBlock> &blocks() const { return _blocks; }
+
+  /**
+   *  Возвращает параметры адресного пространства.
+   */
+  const MemoryConfig &config() const { return _config; }
+
+  /**
+   *  @brief Возвращает блок памяти по ссылке на него.
+   *
+   *  @param handle Ссылка на блок памяти.
+   */
+  const MemoryBlock &block(BlockHandle handle) const { return *handle; }
+
+  /**
+   *  Возвращает порядок, в котором хранятся свободные блоки памяти.
+   */
+  FreeBlocksOrder order() const { return _order; }
+
+  /**
+   *  Возвращает true, если в памяти нет соседних свободных блоков.
+   */
+  bool compressed() const { return _compressed; }
+
+  /**
+   *  Возвращает способ уплотнения памяти.
+   */
+  CompactionMode compaction() const { return _compaction; }
+
+  /**
+   *  @brief Задает способ уплотнения памяти.
+   *
+   *  @param mode Способ уплотнения памяти.
+   */
+  void setCompaction(CompactionMode mode) { _compaction = mode; }
+
+  /**
+   *  Возвращает суммарный размер блоков (в страницах), перемещенных при
+   *  уплотнении памяти.
+   */
+  int64_t pagesMoved() const { return _pagesMoved; }
+
+  /**
+   *  @brief Проверяет, выделены ли процессу какие-либо блоки памяти.
+   *
+   *  @param pid Идентификатор процесса.
+   */
+  bool hasProcess(int32_t pid) const {
+    return _processBlocks.find(pid) != _processBlocks.end();
+  }
+
+  /**
+   *  @brief Возвращает блоки памяти, выделенные процессу.
+   *
+   *  @param pid Идентификатор процесса.
+   *
+   *  @return Массив блоков, упорядоченных по начальному адресу.
+   */
+  std::vector<BlockHandle> processBlocks(int32_t pid) const {
+    std::vector<BlockHandle> blocks;
+    if (auto pos = _processBlocks.find(pid); pos != _processBlocks.end()) {
+      blocks.reserve(pos->second.size());
+      for (const auto &[address, block] : pos->second) {
+        blocks.push_back(block);
+      }
+    }
+    return blocks;
+  }
+
+  /**
+   *  Возвращает суммарный размер свободных блоков памяти (в страницах).
+   */
+  int32_t totalFree() const {
+    int32_t totalFree = 0;
+    for (const auto &[key, block] : _freeBlocks) {
+      totalFree += block->size();
+    }
+    return totalFree;
+  }
+
+  /**
+   *  @brief Ищет блок памяти, начинающийся с заданного адреса.
+   *
+   *  @param address Адрес начала блока памяти.
+   *
+   *  @return Ссылка на блок или tl::nullopt, если такого блока нет.
+   */
+  tl::optional<BlockHandle> findBlock(int32_t address) const {
+    for (auto block = _blocks.cbegin(); block != _blocks.cend(); ++block) {
+      if (block->address() == address) {
+        return block;
+      }
+    }
+    return tl::nullopt;
+  }
+
+  /**
+   *  @brief Возвращает блок памяти, предшествующий заданному.
+   *
+   *  @param handle Ссылка на блок памяти.
+   *
+   *  @return Ссылка на блок или tl::nullopt, если @a handle - первый блок.
+   */
+  tl::optional<BlockHandle> previousBlock(BlockHandle handle) const {
+    if (handle == _blocks.cbegin()) {
+      return tl::nullopt;
+    }
+    return std::prev(handle);
+  }
+
+  /**
+   *  @brief Возвращает блок памяти, следующий за заданным.
+   *
+   *  @param handle Ссылка на блок памяти.
+   *
+   *  @return Ссылка на блок или tl::nullopt, если @a handle - последний блок.
+   */
+  tl::optional<BlockHandle> nextBlock(BlockHandle handle) const {
+    auto next = std::next(handle);
+    if (next == _blocks.cend()) {
+      return tl::nullopt;
+    }
+    return next;
+  }
+
+  /**
+   *  @brief Ищет блок памяти, выделенный процессу и начинающийся с заданного
+   *  адреса.
+   *
+   *  @param pid Идентификатор процесса.
+   *  @param address Адрес начала блока памяти.
+   *
+   *  @return Ссылка на блок или tl::nullopt, если такого блока нет.
+   */
+  tl::optional<BlockHandle> findProcessBlock(int32_t pid,
+                                             int32_t address) const {
+    auto process = _processBlocks.find(pid);
+    if (process == _processBlocks.end()) {
+      return tl::nullopt;
+    }
+    auto pos = process->second.find(address);
+    if (pos == process->second.end()) {
+      return tl::nullopt;
+    }
+    return pos->second;
+  }
+
+  /**
+   *  @brief Ищет первый в порядке хранения свободный блок памяти, размер
+   *  которого не меньше @a size.
+   *
+   *  Для порядка SEGREGATED поиск выполняется по схеме TLSF: выбирается
+   *  первый блок наименьшего непустого класса, все блоки которого не меньше
+   *  @a size. Если такого класса нет, то просматриваются блоки класса, к
+   *  которому относится сам размер @a size.
+   *
+   *  Для порядка ROVING поиск начинается с блока, на котором он остановился
+   *  при последнем выделении памяти, и продолжается с начала памяти.
+   *
+   *  @param size Требуемый размер блока памяти.
+   *
+   *  @return Ссылка на блок или tl::nullopt, если подходящего блока нет.
+   */
+  tl::optional<BlockHandle> findFreeBlock(int32_t size) const {
+    switch (_order) {
+    case FreeBlocksOrder::SIZE_ASCENDING: {
+      // наименьший блок среди блоков, размер которых не меньше size
+      auto pos = _freeBlocks.lower_bound(
+          {size, std::numeric_limits<int32_t>::min()});
+      if (pos != _freeBlocks.end()) {
+        return pos->second;
+      }
+      return tl::nullopt;
+    }
+    case FreeBlocksOrder::SIZE_DESCENDING: {
+      // наибольший блок находится в начале индекса
+      auto pos = _freeBlocks.begin();
+      if (pos != _freeBlocks.end() && pos->second->size() >= size) {
+        return pos->second;
+      }
+      return tl::nullopt;
+    }
+    case FreeBlocksOrder::SEGREGATED: {
+      auto searchClass = TlsfIndex::searchClassOf(size);
+      if (auto index = _segregated.findClass(searchClass); index) {
+        return _freeBlocks
+            .lower_bound({*index, std::numeric_limits<int32_t>::min()})
+            ->second;
+      }
+
+      // блоки класса, к которому относится size, могут быть меньше size
+      auto index = TlsfIndex::classOf(size);
+      for (auto pos = _freeBlocks.lower_bound(
+               {index, std::numeric_limits<int32_t>::min()});
+           pos != _freeBlocks.end() && pos->first.first == index;
+           ++pos) {
+        if (pos->second->size() >= size) {
+          return pos->second;
+        }
+      }
+      return tl::nullopt;
+    }
+    case FreeBlocksOrder::ROVING: {
+      if (_freeBlocks.empty()) {
+        return tl::nullopt;
+      }
+      auto rover = roverPosition();
+      auto pos = rover;
+      do {
+        if (pos->second->size() >= size) {
+          return pos->second;
+        }
+        if (++pos == _freeBlocks.end()) {
+          pos = _freeBlocks.begin();
+        }
+      } while (pos != rover);
+      return tl::nullopt;
+    }
+    default:
+      for (const auto &[key, block] : _freeBlocks) {
+        if (block->size() >= size) {
+          return block;
+        }
+      }
+      return tl::nullopt;
+    }
+  }
+
+  /**
+   *  @brief Операция выделения памяти процессу в заданном блоке памяти.
+   *
+   *  @see MemoryManagement::allocateMemory().
+   */
+  void allocateMemory(BlockHandle handle, int32_t pid, int32_t pages) {
+    auto block = *handle;
+    if (block.pid() != -1) {
+      throw OperationException("BLOCK_IS_USED");
+    } else if (block.size() < pages) {
+      throw OperationException("TOO_SMALL");
+    }
+
+    auto freeBlockSize = block.size() - pages;
+    auto freeBlockAddress = block.address() + pages;
+
+    eraseFreeBlock(handle);
+    mutableBlock(handle) =
+        MemoryBlock(pid, block.address(), pages, _config.pages());
+    insertProcessBlock(handle);
+    if (freeBlockSize > 0) {
+      auto freeBlock = _blocks.emplace(std::next(handle),
+                                       -1,
+                                       freeBlockAddress,
+                                       freeBlockSize,
+                                       _config.pages());
+      insertFreeBlock(freeBlock);
+    }
+
+    if (_order == FreeBlocksOrder::ROVING) {
+      // следующий поиск начнется с первого свободного блока после
+      // выделенного; если свободных блоков нет - с первого освобожденного
+      _rover = block.address() + pages;
+      if (!_freeBlocks.empty()) {
+        _rover = roverPosition()->second->address();
+      }
+    }
+  }
+
+  /**
+   *  @brief Операция освобождения блока памяти, принадлежащего процессу.
+   *
+   *  @see MemoryManagement::freeMemory().
+   */
+  void freeMemory(int32_t pid, BlockHandle handle) {
+    if (handle->pid() != pid) {
+      throw OperationException("PID_MISMATCH");
+    }
+
+    if (_order == FreeBlocksOrder::ROVING && _freeBlocks.empty()) {
+      _rover = handle->address();
+    }
+    eraseProcessBlock(handle);
+    mutableBlock(handle) =
+        MemoryBlock(-1, handle->address(), handle->size(), _config.pages());
+    insertFreeBlock(handle);
+    _compressed = false;
+  }
+
+  /**
+   *  @brief Освобождает блок памяти, принадлежащий процессу, и объединяет его
+   *  с соседними свободными блоками.
+   *
+   *  Если до освобождения в памяти были соседние свободные блоки, то
+   *  объединение не выполняется: в этом случае память должна быть сжата
+   *  целиком с помощью compressAllMemory().
+   *
+   *  @param pid Идентификатор процесса.
+   *  @param handle Блок памяти, который необходимо освободить.
+   *
+   *  @return Свободный блок, в который вошел освобожденный блок.
+   *
+   *  @throws MemoryManagement::OperationException Исключение возникает, если
+   *  блок памяти выделен другому процессу ("PID_MISMATCH").
+   */
+  BlockHandle releaseMemory(int32_t pid, BlockHandle handle) {
+    auto compressed = _compressed;
+    freeMemory(pid, handle);
+    if (!compressed) {
+      return handle;
+    }
+
+    // в сжатой памяти соседи освобожденного блока - единственные свободные
+    // блоки, с которыми его можно объединить
+    auto start = handle;
+    if (start != _blocks.cbegin() && std::prev(start)->pid() == -1) {
+      start = std::prev(start);
+    }
+    auto next = std::next(handle);
+    if (start != handle || (next != _blocks.cend() && next->pid() == -1)) {
+      compressMemory(start);
+    }
+
+    _compressed = true;
+    return start;
+  }
+
+  /**
+   *  @brief Операция дефрагментации памяти.
+   *
+   *  @see MemoryManagement::defragmentMemory().
+   */
+  void defragmentMemory() {
+    int32_t address = 0;
+    int32_t freeMemory = 0;
+
+    // адреса всех занятых блоков меняются, поэтому индекс блоков процессов
+    // строится заново
+    _processBlocks.clear();
+    for (auto block = _blocks.begin(); block != _blocks.end();) {
+      if (block->pid() != -1) {
+        if (block->address() != address) {
+          _pagesMoved += block->size();
+        }
+        *block = MemoryBlock(
+            block->pid(), address, block->size(), _config.pages());
+        insertProcessBlock(block);
+        address += block->size();
+        ++block;
+      } else {
+        freeMemory += block->size();
+        block = _blocks.erase(block);
+      }
+    }
+
+    _freeBlocks.clear();
+    _segregated.clear();
+    auto freeBlock = _blocks.emplace(
+        _blocks.end(), -1, address, freeMemory, _config.pages());
+    insertFreeBlock(freeBlock);
+    _compressed = true;
+  }
+
+  /**
+   *  @brief Уплотняет память так, чтобы в ней появился свободный блок, размер
+   *  которого не меньше @a pages.
+   *
+   *  В режиме FULL выполняет дефрагментацию всей памяти. В режиме MINIMAL
+   *  выбирает последовательность блоков, которая начинается и заканчивается
+   *  свободными блоками, суммарно содержит не меньше @a pages свободных
+   *  страниц и при этом наименьшее число занятых. Занятые блоки этой
+   *  последовательности сдвигаются к ее началу, а свободные объединяются в
+   *  один блок в ее конце. Остальные блоки не перемещаются.
+   *
+   *  Если суммарно свободной памяти недостаточно, то ничего не делает.
+   *
+   *  @param pages Требуемый размер свободного блока (в страницах).
+   */
+  void compactMemory(int32_t pages) {
+    if (_compaction == CompactionMode::FULL) {
+      defragmentMemory();
+      return;
+    }
+
+    std::vector<BlockHandle> freeBlocks;
+    for (auto block = _blocks.cbegin(); block != _blocks.cend(); ++block) {
+      if (block->pid() == -1) {
+        freeBlocks.push_back(block);
+      }
+    }
+
+    // для каждого последнего блока последовательности выбираем ближайший к
+    // нему первый блок, при котором свободной памяти достаточно
+    tl::optional<std::pair<size_t, size_t>> best;
+    int64_t bestUsed = 0, freeMemory = 0;
+    for (size_t first = 0, last = 0; last < freeBlocks.size(); ++last) {
+      freeMemory += freeBlocks[last]->size();
+      while (freeMemory - freeBlocks[first]->size() >= pages) {
+        freeMemory -= freeBlocks[first]->size();
+        ++first;
+      }
+      if (freeMemory < pages) {
+        continue;
+      }
+      int64_t used = freeBlocks[last]->address() + freeBlocks[last]->size() -
+                     freeBlocks[first]->address() - freeMemory;
+      if (!best.has_value() || used < bestUsed) {
+        best = std::make_pair(first, last);
+        bestUsed = used;
+      }
+    }
+    if (!best.has_value()) {
+      return;
+    }
+
+    auto start = freeBlocks[best->first];
+    auto end = std::next(freeBlocks[best->second]);
+    auto address = start->address();
+    int32_t freePages = 0;
+    for (auto block = start; block != end;) {
+      if (block->pid() != -1) {
+        _pagesMoved += block->size();
+        eraseProcessBlock(block);
+        mutableBlock(block) = MemoryBlock(
+            block->pid(), address, block->size(), _config.pages());
+        insertProcessBlock(block);
+        address += block->size();
+        ++block;
+      } else {
+        freePages += block->size();
+        eraseFreeBlock(block);
+        block = _blocks.erase(block);
+      }
+    }
+
+    auto freeBlock =
+        _blocks.emplace(end, -1, address, freePages, _config.pages());
+    insertFreeBlock(freeBlock);
+  }
+
+  /**
+   *  @brief Операция сжатия памяти.
+   *
+   *  @see MemoryManagement::compressMemory().
+   */
+  void compressMemory(BlockHandle start) {
+    auto last = start;
+    int32_t freeMemory = 0;
+    int32_t count = 0;
+    while (last != _blocks.cend() && last->pid() == -1) {
+      freeMemory += last->size();
+      ++last;
+      ++count;
+    }
+
+    if (count < 2) {
+      throw OperationException("SINGLE_BLOCK");
+    }
+
+    for (auto block = start; block != last; ++block) {
+      eraseFreeBlock(block);
+    }
+
+    auto address = start->address();
+    mutableBlock(start) = MemoryBlock(-1, address, freeMemory, _config.pages());
+    _blocks.erase(std::next(start), last);
+    insertFreeBlock(start);
+  }
+
+  /**
+   *  @brief Делит свободный блок памяти на два свободных блока.
+   *
+   *  @param handle Свободный блок памяти. После деления ссылается на первый
+   *  из блоков.
+   *  @param size Размер первого блока (в страницах).
+   *
+   *  @return Второй из блоков.
+   *
+   *  @throws MemoryManagement::OperationException Исключение возникает в
+   *  следующих случаях:
+   *
+   *  "BLOCK_IS_USED" - блок памяти выделен процессу;
+   *  "TOO_SMALL" - размер блока не больше @a size.
+   */
+  BlockHandle splitFreeBlock(BlockHandle handle, int32_t size) {
+    auto block = *handle;
+    if (block.pid() != -1) {
+      throw OperationException("BLOCK_IS_USED");
+    } else if (block.size() <= size) {
+      throw OperationException("TOO_SMALL");
+    }
+
+    eraseFreeBlock(handle);
+    mutableBlock(handle) =
+        MemoryBlock(-1, block.address(), size, _config.pages());
+    insertFreeBlock(handle);
+    auto second = _blocks.emplace(std::next(handle),
+                                  -1,
+                                  block.address() + size,
+                                  block.size() - size,
+                                  _config.pages());
+    insertFreeBlock(second);
+    _compressed = false;
+    return second;
+  }
+
+  /**
+   *  @brief Объединяет свободный блок памяти со следующим за ним свободным
+   *  блоком.
+   *
+   *  В отличие от compressMemory(), остальные следующие за ними свободные
+   *  блоки не затрагиваются.
+   *
+   *  @param handle Свободный блок памяти. После объединения ссылается на
+   *  объединенный блок.
+   *
+   *  @throws MemoryManagement::OperationException Исключение возникает, если
+   *  блок памяти или следующий за ним блок не являются свободными
+   *  ("SINGLE_BLOCK").
+   */
+  void mergeFreeBlocks(BlockHandle handle) {
+    auto next = std::next(handle);
+    if (handle->pid() != -1 || next == _blocks.cend() || next->pid() != -1) {
+      throw OperationException("SINGLE_BLOCK");
+    }
+
+    eraseFreeBlock(handle);
+    eraseFreeBlock(next);
+    mutableBlock(handle) = MemoryBlock(
+        -1, handle->address(), handle->size() + next->size(), _config.pages());
+    _blocks.erase(next);
+    insertFreeBlock(handle);
+  }
+
+  /**
+   *  @brief Выполняет сжатие памяти - объединение соседних свободных блоков в
+   *  один.
+   *
+   *  Все последовательности соседних свободных блоков объединяются за один
+   *  проход по списку блоков. Если память уже сжата, то ничего не делает.
+   */
+  void compressAllMemory() {
+    if (_compressed) {
+      return;
+    }
+
+    for (auto block = _blocks.cbegin(); block != _blocks.cend(); ++block) {
+      // если за свободным блоком следует хотя бы один свободный блок, то
+      // объединяем их
+      auto next = std::next(block);
+      if (block->pid() == -1 && next != _blocks.cend() &&
+          next->pid() == -1) {
+        compressMemory(block);
+      }
+    }
+
+    _compressed = true;
+  }
+
+  /**
+   *  @brief Упорядочивает свободные блоки памяти.
+   *
+   *  Если блоки уже хранятся в заданном порядке, то ничего не делает. Для
+   *  порядка ROVING поиск будет начинаться с первого в текущем порядке блока.
+   *
+   *  @param order Порядок свободных блоков памяти.
+   */
+  void sortFreeBlocks(FreeBlocksOrder order) {
+    if (order == _order) {
+      return;
+    }
+
+    if (order == FreeBlocksOrder::ROVING) {
+      _rover = _freeBlocks.empty() ? 0 : _freeBlocks.begin()->second->address();
+    }
+
+    std::map<FreeBlockKey, BlockHandle> freeBlocks;
+    freeBlocks.swap(_freeBlocks);
+    _segregated.clear();
+    _order = order;
+    for (const auto &[key, block] : freeBlocks) {
+      insertFreeBlock(block);
+    }
+  }
+
+private:
+  bool hasAdjacentFreeBlocks() const {
+    for (auto block = _blocks.cbegin(); block != _blocks.cend(); ++block) {
+      auto next = std::next(block);
+      if (block->pid() == -1 && next != _blocks.cend() &&
+          next->pid() == -1) {
+        return true;
+      }
+    }
+    return false;
+  }
+
+  MemoryBlock &mutableBlock(BlockHandle handle) {
+    return *_blocks.erase(handle, handle);
+  }
+
+  FreeBlockKey freeBlockKey(const MemoryBlock &block) const {
+    switch (_order) {
+    case FreeBlocksOrder::ADDRESS:
+    case FreeBlocksOrder::ROVING:
+      return {0, block.address()};
+    case FreeBlocksOrder::SIZE_ASCENDING:
+      return {block.size(), block.address()};
+    case FreeBlocksOrder::SIZE_DESCENDING:
+      return {-block.size(), block.address()};
+    case FreeBlocksOrder::SEGREGATED:
+      return {TlsfIndex::classOf(block.size()), block.address()};
+    default:
+      return {_sequence, block.address()};
+    }
+  }
+
+  /**
+   *  Возвращает позицию в индексе свободного блока, с которого начинается
+   *  поиск для порядка ROVING: блока, содержащего адрес _rover (он мог быть
+   *  объединен с предшествующими блоками), или первого блока после него.
+   *  Индекс не должен быть пуст.
+   */
+  std::map<FreeBlockKey, BlockHandle>::const_iterator roverPosition() const {
+    auto pos = _freeBlocks.lower_bound({0, _rover});
+    if (pos != _freeBlocks.begin()) {
+      const auto &previous = *std::prev(pos)->second;
+      if (previous.address() + previous.size() > _rover) {
+        return std::prev(pos);
+      }
+    }
+    return pos != _freeBlocks.end() ? pos : _freeBlocks.begin();
+  }
+
+  void insertProcessBlock(BlockHandle block) {
+    if (block->pid() != -1) {
+      _processBlocks[block->pid()].emplace(block->address(), block);
+    }
+  }
+
+  void eraseProcessBlock(BlockHandle block) {
+    auto process = _processBlocks.find(block->pid());
+    if (process == _processBlocks.end()) {
+      return;
+    }
+    process->second.erase(block->address());
+    if (process->second.empty()) {
+      _processBlocks.erase(process);
+    }
+  }
+
+  void insertFreeBlock(BlockHandle block) {
+    if (_order == FreeBlocksOrder::SEGREGATED) {
+      _segregated.insert(block->size());
+    }
+    _freeBlocks.emplace(freeBlockKey(*block), block);
+    _sequence += 1;
+  }
+
+  void eraseFreeBlock(BlockHandle block) {
+    if (_order == FreeBlocksOrder::SEGREGATED) {
+      _segregated.erase(block->size());
+    }
+    if (_order != FreeBlocksOrder::NONE) {
+      _freeBlocks.erase(freeBlockKey(*block));
+      return;
+    }
+
+    // порядок хранения не связан с параметрами блока, поэтому ищем блок
+    // перебором
+    for (auto pos = _freeBlocks.begin(); pos != _freeBlocks.end(); ++pos) {
+      if (pos->second == block) {
+        _freeBlocks.erase(pos);
+        return;
+      }
+    }
+  }
+};
+} // namespace MemoryManagement
@@ -2,6 +2,7 @@
 
 #include <algorithm>
 #include <cstdint>
+#include <utility>
 #include <vector>
 
 #include "exceptions.h"
@@ -35,7 +36,7 @@ inline MemoryState allocateMemory(const MemoryState &state,
                                   uint32_t blockIndex,
                                   int32_t pid,
                                   int32_t pages) {
-  auto [blocks, freeBlocks] = state;
+  auto [blocks, freeBlocks, config] = state;
 
   auto block = blocks.at(blockIndex);
   if (block.pid() != -1) {
@@ -44,24 +45,27 @@ inline MemoryState allocateMemory(const MemoryState &state,
     throw OperationException("TOO_SMALL");
   }
 
-  auto allocatedBlock = MemoryBlock(pid, block.address(), pages);
+  auto allocatedBlock =
+      MemoryBlock(pid, block.address(), pages, config.pages());
   auto freeBlockSize = block.size() - pages;
   auto freeBlockAddress = block.address() + pages;
 
   blocks.erase(blocks.begin() + blockIndex);
   if (freeBlockSize > 0) {
-    blocks.insert(blocks.begin() + blockIndex,
-                  MemoryBlock(-1, freeBlockAddress, freeBlockSize));
+    blocks.insert(
+        blocks.begin() + blockIndex,
+        MemoryBlock(-1, freeBlockAddress, freeBlockSize, config.pages()));
   }
   blocks.insert(blocks.begin() + blockIndex, allocatedBlock);
 
   auto pos = std::find(freeBlocks.begin(), freeBlocks.end(), block);
   freeBlocks.erase(pos);
   if (freeBlockSize > 0) {
-    freeBlocks.emplace_back(-1, freeBlockAddress, freeBlockSize);
+    freeBlocks.emplace_back(
+        -1, freeBlockAddress, freeBlockSize, config.pages());
   }
 
-  return {blocks, freeBlocks};
+  return {std::move(blocks), std::move(freeBlocks), config};
 }
 
 /**
@@ -87,17 +91,18 @@ inline MemoryState allocateMemory(const MemoryState &state,
  */
 inline MemoryState
 freeMemory(const MemoryState &state, int32_t pid, uint32_t blockIndex) {
-  auto [blocks, freeBlocks] = state;
+  auto [blocks, freeBlocks, config] = state;
 
   auto block = blocks.at(blockIndex);
   if (block.pid() != pid) {
     throw OperationException("PID_MISMATCH");
   }
 
-  blocks[blockIndex] = MemoryBlock(-1, block.address(), block.size());
+  blocks[blockIndex] =
+      MemoryBlock(-1, block.address(), block.size(), config.pages());
   freeBlocks.push_back(blocks[blockIndex]);
 
-  return {blocks, freeBlocks};
+  return {std::move(blocks), std::move(freeBlocks), config};
 }
 
 /**
@@ -111,7 +116,7 @@ freeMemory(const MemoryState &state, int32_t pid, uint32_t blockIndex) {
  *  Освободившаяся память собирается в один блок.
  */
 inline MemoryState defragmentMemory(const MemoryState &state) {
-  auto [blocks, freeBlocks] = state;
+  auto [blocks, freeBlocks, config] = state;
 
   int32_t address = 0;
   int32_t freeMemory = 0;
@@ -119,17 +124,18 @@ inline MemoryState defragmentMemory(const MemoryState &state) {
 
   for (const auto &block : blocks) {
     if (block.pid() != -1) {
-      newBlocks.emplace_back(block.pid(), address, block.size());
+      newBlocks.emplace_back(
+          block.pid(), address, block.size(), config.pages());
       address += block.size();
     } else {
       freeMemory += block.size();
     }
   }
 
-  newBlocks.emplace_back(-1, address, freeMemory);
-  freeBlocks = {{-1, address, freeMemory}};
+  newBlocks.emplace_back(-1, address, freeMemory, config.pages());
+  freeBlocks = {{-1, address, freeMemory, config.pages()}};
 
-  return {newBlocks, freeBlocks};
+  return {newBlocks, freeBlocks, config};
 }
 
 /**
@@ -153,7 +159,7 @@ inline MemoryState defragmentMemory(const MemoryState &state) {
  */
 inline MemoryState compressMemory(const MemoryState &state,
                                   uint32_t startBlockIndex) {
-  auto [blocks, freeBlocks] = state;
+  auto [blocks, freeBlocks, config] = state;
 
   std::vector<MemoryBlock> newBlocks(blocks.begin(),
                                      blocks.begin() + startBlockIndex);
@@ -175,11 +181,11 @@ inline MemoryState compressMemory(const MemoryState &state,
     throw OperationException("SINGLE_BLOCK");
   }
 
-  newBlocks.emplace_back(-1, address, freeMemory);
+  newBlocks.emplace_back(-1, address, freeMemory, config.pages());
   newBlocks.insert(
       newBlocks.end(), blocks.begin() + currentBlock, blocks.end());
-  freeBlocks.emplace_back(-1, address, freeMemory);
+  freeBlocks.emplace_back(-1, address, freeMemory, config.pages());
 
-  return {newBlocks, freeBlocks};
+  return {newBlocks, freeBlocks, config};
 }
 } // namespace MemoryManagement
@@ -0,0 +1,162 @@
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+namespace MemoryManagement {
+/**
+ *  @brief Битовая карта страниц памяти.
+ *
+ *  Биты хранятся в 64-битных словах, поэтому поиск ближайшего установленного
+ *  или сброшенного бита просматривает по 64 страницы за одну итерацию.
+ */
+class PageBitmap {
+public:
+  static constexpr int32_t WORD_BITS = 64;
+
+private:
+  std::vector<uint64_t> _words;
+
+  int32_t _size;
+
+public:
+  /**
+   *  @brief Создает битовую карту, все биты которой сброшены.
+   *
+   *  @param size Количество бит.
+   */
+  explicit PageBitmap(int32_t size = 0)
+      : _words((static_cast<size_t>(size) + WORD_BITS - 1) / WORD_BITS),
+        _size(size) {}
+
+  /**
+   *  Возвращает количество бит.
+   */
+  int32_t size() const { return _size; }
+
+  /**
+   *  Возвращает слова, в которых хранятся биты.
+   */
+  const std::vector<uint64_t> &words() const { return _words; }
+
+  std::vector<uint64_t> &words() { return _words; }
+
+  bool test(int32_t pos) const {
+    return (_words[pos / WORD_BITS] >> (pos % WORD_BITS)) & 1;
+  }
+
+  void set(int32_t pos) {
+    _words[pos / WORD_BITS] |= uint64_t(1) << (pos % WORD_BITS);
+  }
+
+  void reset(int32_t pos) {
+    _words[pos / WORD_BITS] &= ~(uint64_t(1) << (pos % WORD_BITS));
+  }
+
+  /**
+   *  @brief Устанавливает или сбрасывает биты в диапазоне [from, to).
+   *
+   *  @param from Номер первого бита.
+   *  @param to Номер бита, следующего за последним.
+   *  @param value Новое значение бит.
+   */
+  void assign(int32_t from, int32_t to, bool value) {
+    while (from < to) {
+      auto offset = from % WORD_BITS;
+      auto count = std::min(WORD_BITS - offset, to - from);
+      auto mask = count == WORD_BITS ? ~uint64_t(0)
+                                     : ((uint64_t(1) << count) - 1) << offset;
+      if (value) {
+        _words[from / WORD_BITS] |= mask;
+      } else {
+        _words[from / WORD_BITS] &= ~mask;
+      }
+      from += count;
+    }
+  }
+
+  /**
+   *  Возвращает номер первого установленного бита, начиная с @a from, или
+   *  size(), если такого бита нет.
+   */
+  int32_t findSet(int32_t from) const { return find(from, 0); }
+
+  /**
+   *  Возвращает номер первого сброшенного бита, начиная с @a from, или
+   *  size(), если такого бита нет.
+   */
+  int32_t findReset(int32_t from) const { return find(from, ~uint64_t(0)); }
+
+  /**
+   *  Возвращает номер последнего установленного бита, предшествующего @a pos,
+   *  или -1, если такого бита нет.
+   */
+  int32_t findSetBefore(int32_t pos) const {
+    if (pos <= 0) {
+      return -1;
+    }
+
+    auto index = static_cast<size_t>(pos - 1) / WORD_BITS;
+    auto word = _words[index] & (~uint64_t(0) >> (63 - (pos - 1) % WORD_BITS));
+    while (word == 0) {
+      if (index == 0) {
+        return -1;
+      }
+      word = _words[--index];
+    }
+    return static_cast<int32_t>(index * WORD_BITS + highestBit(word));
+  }
+
+  /**
+   *  Возвращает номер младшего установленного бита @a word (@a word != 0).
+   */
+  static int32_t lowestBit(uint64_t word) {
+#if defined(_MSC_VER)
+    unsigned long index;
+    _BitScanForward64(&index, word);
+    return static_cast<int32_t>(index);
+#else
+    return __builtin_ctzll(word);
+#endif
+  }
+
+  /**
+   *  Возвращает номер старшего установленного бита @a word (@a word != 0).
+   */
+  static int32_t highestBit(uint64_t word) {
+#if defined(_MSC_VER)
+    unsigned long index;
+    _BitScanReverse64(&index, word);
+    return static_cast<int32_t>(index);
+#else
+    return 63 - __builtin_clzll(word);
+#endif
+  }
+
+private:
+  int32_t find(int32_t from, uint64_t flip) const {
+    if (from >= _size) {
+      return _size;
+    }
+
+    auto index = static_cast<size_t>(from) / WORD_BITS;
+    auto word = (_words[index] ^ flip) & (~uint64_t(0) << (from % WORD_BITS));
+    while (word == 0) {
+      if (++index == _words.size()) {
+        return _size;
+      }
+      word = _words[index] ^ flip;
+    }
+
+    // в последнем слове биты за пределами карты сброшены, поэтому при поиске
+    // сброшенного бита результат может выйти за ее границу
+    auto pos = static_cast<int64_t>(index) * WORD_BITS + lowestBit(word);
+    return static_cast<int32_t>(std::min<int64_t>(pos, _size));
+  }
+};
+} // namespace MemoryManagement
@@ -6,6 +6,7 @@
 #include <nlohmann/json.hpp>
 
 #include "exceptions.h"
+#include "types.h"
 
 namespace MemoryManagement {
 
@@ -16,17 +17,22 @@ class CreateProcessReq {
 private:
   int32_t _pid;
 
-  int32_t _bytes;
+  int64_t _bytes;
 
 public:
   CreateProcessReq &operator=(const CreateProcessReq &rhs) = default;
 
   int32_t pid() const { return _pid; }
 
-  int32_t bytes() const { return _bytes; }
+  int64_t bytes() const { return _bytes; }
 
-  int32_t pages() const {
-    return _bytes % 4096 == 0 ? _bytes / 4096 : (_bytes + 4096) / 4096;
+  /**
+   *  @brief Возвращает количество страниц для выделения процессу в памяти.
+   *
+   *  @param config Параметры адресного пространства.
+   */
+  int32_t pages(const MemoryConfig &config = MemoryConfig()) const {
+    return config.toPages(_bytes);
   }
 
   /**
@@ -41,15 +47,19 @@ public:
    *
    *  @param pid Идентификатор процесса.
    *  @param bytes Количество байт для выделения процессу в памяти.
+   *  @param config Параметры адресного пространства.
    *
    *  @throws MemoryManagement::RequestException Исключение возникает, если
    *  переданные параметры не соответствуют заданным ограничениям.
    */
-  CreateProcessReq(int32_t pid, int32_t bytes) : _pid(pid), _bytes(bytes) {
-    if (pid < 0 || pid > 255) {
+  CreateProcessReq(int32_t pid,
+                   int64_t bytes,
+                   const MemoryConfig &config = MemoryConfig())
+      : _pid(pid), _bytes(bytes) {
+    if (pid < 0 || pid > MemoryBlock::MAX_PID) {
       throw RequestException("INVALID_PID");
     }
-    if (bytes < 1 || bytes > 256 * 4096) {
+    if (bytes < 1 || bytes > config.bytes()) {
       throw RequestException("INVALID_BYTES");
     }
   }
@@ -83,7 +93,7 @@ public:
    *  переданные параметры не соответствуют заданным ограничениям.
    */
   TerminateProcessReq(int32_t pid) : _pid(pid) {
-    if (pid < 0 || pid > 255) {
+    if (pid < 0 || pid > MemoryBlock::MAX_PID) {
       throw RequestException("INVALID_PID");
     }
   }
@@ -96,15 +106,20 @@ class AllocateMemory {
 private:
   int32_t _pid;
 
-  int32_t _bytes;
+  int64_t _bytes;
 
 public:
   int32_t pid() const { return _pid; }
 
-  int32_t bytes() const { return _bytes; }
+  int64_t bytes() const { return _bytes; }
 
-  int32_t pages() const {
-    return _bytes % 4096 == 0 ? _bytes / 4096 : (_bytes + 4096) / 4096;
+  /**
+   *  @brief Возвращает количество страниц для выделения процессу в памяти.
+   *
+   *  @param config Параметры адресного пространства.
+   */
+  int32_t pages(const MemoryConfig &config = MemoryConfig()) const {
+    return config.toPages(_bytes);
   }
 
   AllocateMemory &operator=(const AllocateMemory &rhs) = default;
@@ -121,16 +136,19 @@ public:
    *
    *  @param pid Идентификатор процесса.
    *  @param bytes Количество байт для выделения процессу в памяти.
-   *  @param pages Количества страниц для выделения процессу в памяти.
+   *  @param config Параметры адресного пространства.
    *
    *  @throws MemoryManagement::RequestException Исключение возникает, если
    *  переданные параметры не соответствуют заданным ограничениям.
    */
-  AllocateMemory(int32_t pid, int32_t bytes) : _pid(pid), _bytes(bytes) {
-    if (pid < 0 || pid > 255) {
+  AllocateMemory(int32_t pid,
+                 int64_t bytes,
+                 const MemoryConfig &config = MemoryConfig())
+      : _pid(pid), _bytes(bytes) {
+    if (pid < 0 || pid > MemoryBlock::MAX_PID) {
       throw RequestException("INVALID_PID");
     }
-    if (bytes < 1 || bytes > 256 * 4096) {
+    if (bytes < 1 || bytes > config.bytes()) {
       throw RequestException("INVALID_BYTES");
     }
   }
@@ -164,15 +182,19 @@ public:
    *
    *  @param pid Идентификатор процесса.
    *  @param address Адрес начала блока памяти, который нужно освободить.
+   *  @param config Параметры адресного пространства.
    *
    *  @throws MemoryManagement::RequestException Исключение возникает, если
    *  переданные параметры не соответствуют заданным ограничениям.
    */
-  FreeMemory(int32_t pid, int32_t address) : _pid(pid), _address(address) {
-    if (pid < 0 || pid > 255) {
+  FreeMemory(int32_t pid,
+             int32_t address,
+             const MemoryConfig &config = MemoryConfig())
+      : _pid(pid), _address(address) {
+    if (pid < 0 || pid > MemoryBlock::MAX_PID) {
       throw RequestException("INVALID_PID");
     }
-    if (address < 0 || address > 255) {
+    if (address < 0 || address > config.pages() - 1) {
       throw RequestException("INVALID_ADDRESS");
     }
   }
@@ -1,12 +1,16 @@
 #pragma once
 
 #include <algorithm>
+#include <cstddef>
 #include <cstdint>
+#include <limits>
 #include <memory>
 #include <string>
 
 #include <mapbox/variant.hpp>
 
+#include "bitmap_engine.h"
+#include "engine.h"
 #include "operations.h"
 #include "requests.h"
 #include "types.h"
@@ -17,7 +21,10 @@ using std::shared_ptr;
 enum class StrategyType {
   FIRST_APPROPRIATE,
   MOST_APPROPRIATE,
-  LEAST_APPROPRIATE
+  LEAST_APPROPRIATE,
+  BUDDY,
+  TLSF,
+  NEXT_APPROPRIATE
 };
 
 /**
@@ -46,230 +53,208 @@ public:
    */
   MemoryState processRequest(const Request &request,
                              const MemoryState &state) const {
-    return request.match([this, state](const auto &req) {
-      return this->processRequest(req, state);
-    });
+    MemoryEngine engine(state);
+    processRequest(request, engine);
+    return engine.state();
   }
 
   /**
-   *  @brief Обрабатывает заявку на создание нового процесса.
+   *  @brief Обрабатывает заявку любого типа, изменяя состояние памяти на месте.
    *
    *  @param request Заявка.
-   *  @param state Дескриптор состояния памяти.
-   *
-   *  @return Новое состояние памяти.
+   *  @param engine Изменяемое состояние памяти.
    */
-  MemoryState processRequest(const CreateProcessReq &request,
-                             const MemoryState &state) const {
-    return sortFreeBlocks(allocateMemoryGeneral(
-        AllocateMemory(request.pid(), request.bytes()), state, true));
+  virtual void processRequest(const Request &request,
+                              MemoryEngine &engine) const {
+    request.match(
+        [this, &engine](const auto &req) { this->handleRequest(req, engine); });
   }
 
   /**
-   *  @brief Обрабатывает заявку на завершение существующего процесса.
+   *  @brief Обрабатывает заявку любого типа, изменяя состояние памяти,
+   *  основанное на битовой карте страниц, на месте.
    *
    *  @param request Заявка.
-   *  @param state Дескриптор состояния памяти.
-   *
-   *  @return Новое состояние памяти.
+   *  @param engine Изменяемое состояние памяти.
    */
-  MemoryState processRequest(const TerminateProcessReq &request,
-                             const MemoryState &state) const {
-    auto currentState = state;
-
-    while (true) {
-      auto [blocks, freeBlocks] = currentState;
-      // ищем очередной блок памяти, выделенный процессу
-      auto pos = std::find_if(
-          blocks.begin(), blocks.end(), [&request](const auto &block) {
-            return request.pid() == block.pid();
-          });
-      if (pos == blocks.end()) {
-        break;
-      }
+  virtual void processRequest(const Request &request,
+                              BitmapMemoryEngine &engine) const {
+    request.match(
+        [this, &engine](const auto &req) { this->handleRequest(req, engine); });
+  }
 
-      // освобождаем блок
-      uint32_t index = static_cast<uint32_t>(pos - blocks.begin());
-      currentState = freeMemory(currentState, request.pid(), index);
+  /**
+   *  @brief Обрабатывает последовательность заявок.
+   *
+   *  Все заявки применяются на месте к одному изменяемому состоянию памяти,
+   *  которое строится один раз. После каждой заявки вызывается @a callback с
+   *  номером заявки в последовательности и изменяемым состоянием памяти;
+   *  снимок состояния (MemoryEngine::state()) создается, только если его
+   *  запрашивает @a callback.
+   *
+   *  @param first Итератор, указывающий на первую заявку.
+   *  @param last Итератор, указывающий за последнюю заявку.
+   *  @param state Начальное состояние памяти.
+   *  @param callback Функция вида void(std::size_t, const MemoryEngine &).
+   *
+   *  @return Состояние памяти после обработки всех заявок.
+   */
+  template <class Iterator, class Callback>
+  MemoryState processRequests(Iterator first,
+                              Iterator last,
+                              const MemoryState &state,
+                              Callback callback) const {
+    MemoryEngine engine(state);
+    for (std::size_t index = 0; first != last; ++first, ++index) {
+      processRequest(*first, engine);
+      callback(index, static_cast<const MemoryEngine &>(engine));
     }
-
-    // сжимаем память
-    // сортируем свободные блоки
-    return sortFreeBlocks(compressAllMemory(currentState));
+    return engine.state();
   }
 
   /**
-   *  @brief Обрабатывает заявку на выделение памяти существующему процессу.
+   *  @brief Обрабатывает последовательность заявок.
    *
-   *  @param request Заявка.
-   *  @param state Дескриптор состояния памяти.
+   *  @param first Итератор, указывающий на первую заявку.
+   *  @param last Итератор, указывающий за последнюю заявку.
+   *  @param state Начальное состояние памяти.
    *
-   *  @return Новое состояние памяти.
+   *  @return Состояние памяти после обработки всех заявок.
    */
-  MemoryState processRequest(const AllocateMemory &request,
-                             const MemoryState &state) const {
-    return sortFreeBlocks(allocateMemoryGeneral(request, state, false));
+  template <class Iterator>
+  MemoryState processRequests(Iterator first,
+                              Iterator last,
+                              const MemoryState &state) const {
+    return processRequests(
+        first, last, state, [](std::size_t, const MemoryEngine &) {});
   }
 
+protected:
   /**
-   *  @brief Обрабатывает заявку на освобождение блока памяти.
+   *  @brief Обрабатывает заявку на создание нового процесса.
    *
    *  @param request Заявка.
-   *  @param state Дескриптор состояния памяти.
+   *  @param engine Изменяемое состояние памяти.
+   */
+  template <class Engine>
+  void handleRequest(const CreateProcessReq &request, Engine &engine) const {
+    allocateMemoryGeneral(
+        AllocateMemory(request.pid(), request.bytes(), engine.config()),
+        engine,
+        true);
+    sortFreeBlocks(engine);
+  }
+
+  /**
+   *  @brief Обрабатывает заявку на завершение существующего процесса.
    *
-   *  @return Новое состояние памяти.
+   *  @param request Заявка.
+   *  @param engine Изменяемое состояние памяти.
    */
-  MemoryState processRequest(const FreeMemory &request,
-                             const MemoryState &state) const {
-    auto currentState = state;
-    auto [blocks, freeBlocks] = currentState;
-
-    // ищем блок, начинающийся с заданного адреса
-    auto pos = std::find_if(
-        blocks.begin(), blocks.end(), [&request](const auto &block) {
-          return block.address() == request.address();
-        });
-    // если такого блока нет, игнорируем заявку
-    if (pos == blocks.end()) {
-      return state;
-    }
-    // если блок выделен другому процессу, игнорируем заявку
-    if (pos->pid() != request.pid()) {
-      return state;
+  template <class Engine>
+  void handleRequest(const TerminateProcessReq &request, Engine &engine) const {
+    // освобождаем все блоки памяти, выделенные процессу
+    for (auto block : engine.processBlocks(request.pid())) {
+      engine.releaseMemory(request.pid(), block);
     }
 
-    // освобождаем блок
-    uint32_t index = static_cast<uint32_t>(pos - blocks.begin());
-    currentState = freeMemory(state, request.pid(), index);
-
     // сжимаем память
     // сортируем свободные блоки
-    return sortFreeBlocks(compressAllMemory(currentState));
+    engine.compressAllMemory();
+    sortFreeBlocks(engine);
   }
 
-protected:
   /**
-   *  @brief Сортирует свободные блоки памяти согласно стратегии.
-   *
-   *  @param state Дескриптор состояния памяти.
+   *  @brief Обрабатывает заявку на выделение памяти существующему процессу.
    *
-   *  @return Новое состояние памяти.
+   *  @param request Заявка.
+   *  @param engine Изменяемое состояние памяти.
    */
-  virtual MemoryState sortFreeBlocks(const MemoryState &state) const = 0;
+  template <class Engine>
+  void handleRequest(const AllocateMemory &request, Engine &engine) const {
+    allocateMemoryGeneral(request, engine, false);
+    sortFreeBlocks(engine);
+  }
 
   /**
-   *  @brief Ищет первый подходящий блок памяти, у которого размер больше, чем
-   *  @a size.
-   *
-   *  @param blocks Список всех блоков памяти.
-   *  @param freeBlocks Список свободных блоков памяти.
-   *  @param size Требуемый размер блока памяти.
+   *  @brief Обрабатывает заявку на освобождение блока памяти.
    *
-   *  @return Итератор на блок памяти из массива @a blocks, либо blocks.cend(),
-   *  если подходящего блока нет.
+   *  @param request Заявка.
+   *  @param engine Изменяемое состояние памяти.
    */
-  virtual std::vector<MemoryBlock>::const_iterator
-  findFreeBlock(const std::vector<MemoryBlock> &blocks,
-                const std::vector<MemoryBlock> &freeBlocks,
-                int32_t size) const final {
-    auto freeBlockPos = std::find_if(
-        freeBlocks.cbegin(), freeBlocks.cend(), [&size](const auto &block) {
-          return size <= block.size();
-        });
-
-    if (freeBlockPos != freeBlocks.cend()) {
-      return std::find(blocks.cbegin(), blocks.cend(), *freeBlockPos);
-    } else {
-      return blocks.cend();
+  template <class Engine>
+  void handleRequest(const FreeMemory &request, Engine &engine) const {
+    // ищем блок процесса, начинающийся с заданного адреса
+    auto block = engine.findProcessBlock(request.pid(), request.address());
+    // если такого блока нет или он выделен другому процессу, игнорируем заявку
+    if (!block.has_value()) {
+      return;
     }
+
+    // освобождаем блок
+    engine.releaseMemory(request.pid(), *block);
+
+    // сжимаем память
+    // сортируем свободные блоки
+    engine.compressAllMemory();
+    sortFreeBlocks(engine);
   }
 
   /**
-   *  @brief Выполняет сжатие памяти - объединение соседних свободных блоков в
-   *  один.
+   *  Возвращает порядок свободных блоков памяти, используемый стратегией.
+   */
+  virtual FreeBlocksOrder freeBlocksOrder() const = 0;
+
+  /**
+   *  @brief Сортирует свободные блоки памяти согласно стратегии.
    *
-   *  @param state Дескриптор состояния памяти.
+   *  После первой сортировки порядок поддерживается индексом свободных блоков
+   *  и повторная сортировка ничего не делает.
    *
-   *  @return Новое состояние памяти.
+   *  @param engine Изменяемое состояние памяти.
    */
-  virtual MemoryState compressAllMemory(const MemoryState &state) const final {
-    auto currentState = state;
-
-    while (true) {
-      auto [blocks, freeBlocks] = currentState;
-      // ищем первый свободный блок памяти
-      // проверяем, есть ли за ним хотя бы один свободный блок
-      uint32_t index = 0;
-      for (; index < blocks.size() - 1 &&
-             !(blocks[index].pid() == -1 && blocks[index + 1].pid() == -1);
-           ++index) {
-      }
-
-      // если есть, то выполняем сжатие
-      if (index < blocks.size() - 1) {
-        currentState = compressMemory(currentState, index);
-      } else {
-        break;
-      }
-    }
-
-    return currentState;
+  template <class Engine> void sortFreeBlocks(Engine &engine) const {
+    engine.sortFreeBlocks(freeBlocksOrder());
   }
 
   /**
    *  @brief Обобщенный алгоритм выделения памяти процессу.
    *
    *  @param request Заявка.
-   *  @param state Дескриптор состояния памяти.
+   *  @param engine Изменяемое состояние памяти.
    *  @param createProcess Флаг, определяющий создается ли при этом новый
    *  процесс или нет.
-   *
-   *  @return Новое состояние памяти.
    */
-  virtual MemoryState
-  allocateMemoryGeneral(const AllocateMemory &request,
-                        const MemoryState &state,
-                        const bool createProcess = false) const final {
-    auto [blocks, freeBlocks] = state;
-
+  template <class Engine>
+  void allocateMemoryGeneral(const AllocateMemory &request,
+                             Engine &engine,
+                             const bool createProcess = false) const {
     // проверяем, выделены ли процессу какие-либо блоки памяти
-    auto processPos = std::find_if(
-        blocks.begin(), blocks.end(), [&request](const auto &block) {
-          return block.pid() == request.pid();
-        });
+    auto processExists = engine.hasProcess(request.pid());
     // обработка некорректных ситуаций:
     // 1. Создание уже существующего процесса
     // 2. Выделение памяти несуществующему процессу
-    if ((processPos != blocks.end() && createProcess) ||
-        (processPos == blocks.end() && !createProcess)) {
-      return state;
+    if ((processExists && createProcess) ||
+        (!processExists && !createProcess)) {
+      return;
     }
 
-    int32_t totalFree = 0;
-    for (const auto &block : freeBlocks) {
-      totalFree += block.size();
-    }
+    auto pages = request.pages(engine.config());
 
     // проверяем, есть ли свободный блок подходящего размера
     // если есть, то выделяем процессу память в этом блоке
-    if (auto pos = findFreeBlock(blocks, freeBlocks, request.pages());
-        pos != blocks.end()) {
-      uint32_t index = static_cast<uint32_t>(pos - blocks.cbegin());
-
-      return allocateMemory(state, index, request.pid(), request.pages());
-    } else if (totalFree >= request.pages()) {
+    if (auto block = engine.findFreeBlock(pages); block) {
+      engine.allocateMemory(*block, request.pid(), pages);
+    } else if (engine.totalFree() >= pages) {
       // если суммарно свободной памяти достаточно,
-      // то выполняем дефрагментацию
-      auto newState = defragmentMemory(state);
-      auto [blocks, freeBlocks] = newState;
-      auto pos = findFreeBlock(blocks, freeBlocks, request.pages());
-      uint32_t index = static_cast<uint32_t>(pos - blocks.cbegin());
-
-      return allocateMemory(newState, index, request.pid(), request.pages());
-    } else {
-      // недостаточно свободной памяти, игнорируем заявку
-      return state;
+      // то выполняем дефрагментацию (или сдвигаем минимальное число страниц,
+      // если так задано в состоянии памяти)
+      engine.compactMemory(pages);
+      auto newBlock = engine.findFreeBlock(pages);
+
+      engine.allocateMemory(newBlock.value(), request.pid(), pages);
     }
+    // иначе недостаточно свободной памяти, игнорируем заявку
   }
 };
 
@@ -288,28 +273,70 @@ public:
 
 protected:
   /**
-   *  @brief Сортирует блоки по начальному адресу в порядке возрастания.
+   *  @brief Свободные блоки упорядочиваются по начальному адресу в порядке
+   *  возрастания.
+   */
+  FreeBlocksOrder freeBlocksOrder() const override {
+    return FreeBlocksOrder::ADDRESS;
+  }
+
+private:
+  FirstAppropriateStrategy()
+      : AbstractStrategy(StrategyType::FIRST_APPROPRIATE) {}
+};
+
+/**
+ *  @brief Стратегия "Следующий подходящий".
+ *
+ *  Поиск свободного блока начинается не с начала памяти, а с блока, на
+ *  котором он остановился при последнем выделении памяти, и продолжается по
+ *  кругу. Свободные блоки упорядочиваются по начальному адресу, начиная с
+ *  этого блока, поэтому место продолжения поиска сохраняется в дескрипторе
+ *  состояния памяти.
+ */
+class NextAppropriateStrategy final : public AbstractStrategy {
+public:
+  std::string toString() const override { return "NEXT_APPROPRIATE"; }
+
+  static shared_ptr<NextAppropriateStrategy> create() {
+    return shared_ptr<NextAppropriateStrategy>(new NextAppropriateStrategy());
+  }
+
+  using AbstractStrategy::processRequest;
+
+  /**
+   *  @brief Обрабатывает заявку любого типа, изменяя состояние памяти на месте.
    *
-   *  @param state Дескриптор состояния памяти.
+   *  Свободные блоки упорядочиваются до обработки заявки, чтобы поиск
+   *  продолжился с первого блока исходного состояния памяти.
    *
-   *  @return Новое состояние памяти.
+   *  @param request Заявка.
+   *  @param engine Изменяемое состояние памяти.
    */
-  MemoryState sortFreeBlocks(const MemoryState &state) const override {
-    auto currentState = state;
-    auto [blocks, freeBlocks] = currentState;
-
-    std::stable_sort(freeBlocks.begin(),
-                     freeBlocks.end(),
-                     [](const auto &left, const auto &right) {
-                       return left.address() < right.address();
-                     });
+  void processRequest(const Request &request,
+                      MemoryEngine &engine) const override {
+    sortFreeBlocks(engine);
+    AbstractStrategy::processRequest(request, engine);
+  }
 
-    return {blocks, freeBlocks};
+  void processRequest(const Request &request,
+                      BitmapMemoryEngine &engine) const override {
+    sortFreeBlocks(engine);
+    AbstractStrategy::processRequest(request, engine);
   }
 
 private:
-  FirstAppropriateStrategy()
-      : AbstractStrategy(StrategyType::FIRST_APPROPRIATE) {}
+  NextAppropriateStrategy()
+      : AbstractStrategy(StrategyType::NEXT_APPROPRIATE) {}
+
+protected:
+  /**
+   *  @brief Свободные блоки упорядочиваются по начальному адресу в порядке
+   *  возрастания по кругу, начиная с блока, на котором остановился поиск.
+   */
+  FreeBlocksOrder freeBlocksOrder() const override {
+    return FreeBlocksOrder::ROVING;
+  }
 };
 
 /**
@@ -329,28 +356,11 @@ private:
 
 protected:
   /**
-   *  @brief Сортирует блоки по размеру в порядке возрастания, а затем по
-   *  начальному адресу в порядке возрастания.
-   *
-   *  @param state Дескриптор состояния памяти.
-   *
-   *  @return Новое состояние памяти.
+   *  @brief Свободные блоки упорядочиваются по размеру в порядке возрастания, а
+   *  затем по начальному адресу в порядке возрастания.
    */
-  MemoryState sortFreeBlocks(const MemoryState &state) const override {
-    auto currentState = state;
-    auto [blocks, freeBlocks] = currentState;
-
-    std::stable_sort(freeBlocks.begin(),
-                     freeBlocks.end(),
-                     [](const auto &left, const auto &right) {
-                       if (left.size() == right.size()) {
-                         return left.address() < right.address();
-                       } else {
-                         return left.size() < right.size();
-                       }
-                     });
-
-    return {blocks, freeBlocks};
+  FreeBlocksOrder freeBlocksOrder() const override {
+    return FreeBlocksOrder::SIZE_ASCENDING;
   }
 };
 
@@ -371,28 +381,286 @@ private:
 
 protected:
   /**
-   *  @brief Сортирует блоки по размеру в порядке убывания, а затем по
-   *  начальному адресу в порядке возрастания.
+   *  @brief Свободные блоки упорядочиваются по размеру в порядке убывания, а
+   *  затем по начальному адресу в порядке возрастания.
+   */
+  FreeBlocksOrder freeBlocksOrder() const override {
+    return FreeBlocksOrder::SIZE_DESCENDING;
+  }
+};
+
+/**
+ *  @brief Стратегия TLSF (Two-Level Segregated Fit).
+ *
+ *  Свободные блоки распределяются по классам размеров (см. TlsfIndex). Для
+ *  выделения памяти выбирается первый блок наименьшего непустого класса, все
+ *  блоки которого не меньше запрошенного размера; класс находится за O(1) по
+ *  битовым картам непустых классов. Освобожденный блок сразу объединяется с
+ *  соседними свободными блоками. Если подходящего блока нет, но суммарно
+ *  свободной памяти достаточно, то, как и в остальных стратегиях, выполняется
+ *  дефрагментация.
+ */
+class TlsfStrategy final : public AbstractStrategy {
+public:
+  std::string toString() const override { return "TLSF"; }
+
+  static shared_ptr<TlsfStrategy> create() {
+    return shared_ptr<TlsfStrategy>(new TlsfStrategy());
+  }
+
+  using AbstractStrategy::processRequest;
+
+  /**
+   *  @brief Обрабатывает заявку любого типа, изменяя состояние памяти на месте.
+   *
+   *  Свободные блоки упорядочиваются по классам до обработки заявки, поэтому
+   *  поиск блока выполняется по индексу классов уже для первой заявки.
+   *
+   *  @param request Заявка.
+   *  @param engine Изменяемое состояние памяти.
+   */
+  void processRequest(const Request &request,
+                      MemoryEngine &engine) const override {
+    sortFreeBlocks(engine);
+    AbstractStrategy::processRequest(request, engine);
+  }
+
+  void processRequest(const Request &request,
+                      BitmapMemoryEngine &engine) const override {
+    sortFreeBlocks(engine);
+    AbstractStrategy::processRequest(request, engine);
+  }
+
+private:
+  TlsfStrategy() : AbstractStrategy(StrategyType::TLSF) {}
+
+protected:
+  /**
+   *  @brief Свободные блоки упорядочиваются по классу размера в порядке
+   *  возрастания, а затем по начальному адресу в порядке возрастания.
+   */
+  FreeBlocksOrder freeBlocksOrder() const override {
+    return FreeBlocksOrder::SEGREGATED;
+  }
+};
+
+/**
+ *  @brief Стратегия "Система двойников".
+ *
+ *  Память выделяется блоками, размер которых - степень двойки, а начальный
+ *  адрес кратен размеру. Для выделения памяти выбирается наименьший
+ *  подходящий свободный блок, который делится пополам до тех пор, пока его
+ *  половина вмещает запрошенную память; вторые половины остаются свободными.
+ *  При освобождении блок объединяется со своим двойником (второй половиной
+ *  блока, из которого он был получен), пока двойник свободен и не разделен.
+ *
+ *  Свободные блоки упорядочиваются по размеру, а затем по начальному адресу,
+ *  поэтому индекс свободных блоков состояния памяти играет роль списков
+ *  свободных блоков каждого размера, а поиск блока выполняется за O(log n).
+ *  Свободные блоки, не являющиеся блоками системы двойников (например,
+ *  исходный блок памяти, размер которой не является степенью двойки), перед
+ *  выделением в них памяти делятся на такие блоки. Дефрагментация памяти не
+ *  выполняется: если подходящего свободного блока нет, заявка игнорируется.
+ */
+class BuddyStrategy final : public AbstractStrategy {
+public:
+  using AbstractStrategy::processRequest;
+
+  std::string toString() const override { return "BUDDY"; }
+
+  static shared_ptr<BuddyStrategy> create() {
+    return shared_ptr<BuddyStrategy>(new BuddyStrategy());
+  }
+
+  void processRequest(const Request &request,
+                      MemoryEngine &engine) const override {
+    request.match(
+        [this, &engine](const auto &req) { this->handleRequest(req, engine); });
+  }
+
+  void processRequest(const Request &request,
+                      BitmapMemoryEngine &engine) const override {
+    request.match(
+        [this, &engine](const auto &req) { this->handleRequest(req, engine); });
+  }
+
+  /**
+   *  @brief Возвращает размер блока, выделяемого для заданного количества
+   *  страниц, - наименьшую степень двойки, не меньшую @a pages.
    *
-   *  @param state Дескриптор состояния памяти.
+   *  @param pages Количество страниц.
+   */
+  static int64_t blockSize(int32_t pages) {
+    int64_t size = 1;
+    while (size < pages) {
+      size *= 2;
+    }
+    return size;
+  }
+
+  /**
+   *  @brief Проверяет, является ли блок памяти блоком системы двойников.
    *
-   *  @return Новое состояние памяти.
+   *  @param block Блок памяти.
    */
-  MemoryState sortFreeBlocks(const MemoryState &state) const override {
-    auto currentState = state;
-    auto [blocks, freeBlocks] = currentState;
-
-    std::stable_sort(freeBlocks.begin(),
-                     freeBlocks.end(),
-                     [](const auto &left, const auto &right) {
-                       if (left.size() == right.size()) {
-                         return left.address() < right.address();
-                       } else {
-                         return left.size() > right.size();
-                       }
-                     });
-
-    return {blocks, freeBlocks};
+  static bool isBuddyBlock(const MemoryBlock &block) {
+    return (block.size() & (block.size() - 1)) == 0 &&
+           block.address() % block.size() == 0;
+  }
+
+private:
+  BuddyStrategy() : AbstractStrategy(StrategyType::BUDDY) {}
+
+protected:
+  /**
+   *  @brief Свободные блоки упорядочиваются по размеру в порядке возрастания, а
+   *  затем по начальному адресу в порядке возрастания.
+   */
+  FreeBlocksOrder freeBlocksOrder() const override {
+    return FreeBlocksOrder::SIZE_ASCENDING;
+  }
+
+  /**
+   *  @brief Обрабатывает заявку на создание нового процесса.
+   *
+   *  @param request Заявка.
+   *  @param engine Изменяемое состояние памяти.
+   */
+  template <class Engine>
+  void handleRequest(const CreateProcessReq &request, Engine &engine) const {
+    sortFreeBlocks(engine);
+    if (!engine.hasProcess(request.pid())) {
+      allocateBuddy(request.pid(), request.pages(engine.config()), engine);
+    }
+  }
+
+  /**
+   *  @brief Обрабатывает заявку на завершение существующего процесса.
+   *
+   *  @param request Заявка.
+   *  @param engine Изменяемое состояние памяти.
+   */
+  template <class Engine>
+  void handleRequest(const TerminateProcessReq &request,
+                     Engine &engine) const {
+    sortFreeBlocks(engine);
+    for (auto block : engine.processBlocks(request.pid())) {
+      releaseBuddy(request.pid(), block, engine);
+    }
+  }
+
+  /**
+   *  @brief Обрабатывает заявку на выделение памяти существующему процессу.
+   *
+   *  @param request Заявка.
+   *  @param engine Изменяемое состояние памяти.
+   */
+  template <class Engine>
+  void handleRequest(const AllocateMemory &request, Engine &engine) const {
+    sortFreeBlocks(engine);
+    if (engine.hasProcess(request.pid())) {
+      allocateBuddy(request.pid(), request.pages(engine.config()), engine);
+    }
+  }
+
+  /**
+   *  @brief Обрабатывает заявку на освобождение блока памяти.
+   *
+   *  @param request Заявка.
+   *  @param engine Изменяемое состояние памяти.
+   */
+  template <class Engine>
+  void handleRequest(const FreeMemory &request, Engine &engine) const {
+    sortFreeBlocks(engine);
+    // если блока нет или он выделен другому процессу, игнорируем заявку
+    if (auto block = engine.findProcessBlock(request.pid(), request.address());
+        block.has_value()) {
+      releaseBuddy(request.pid(), *block, engine);
+    }
+  }
+
+  /**
+   *  @brief Выделяет процессу блок системы двойников.
+   *
+   *  @param pid Идентификатор процесса.
+   *  @param pages Запрошенное количество страниц.
+   *  @param engine Изменяемое состояние памяти.
+   */
+  template <class Engine>
+  void allocateBuddy(int32_t pid, int32_t pages, Engine &engine) const {
+    auto size = blockSize(pages);
+    if (size > engine.config().pages()) {
+      return;
+    }
+
+    while (auto handle = engine.findFreeBlock(static_cast<int32_t>(size))) {
+      if (!isBuddyBlock(engine.block(*handle))) {
+        splitToBuddies(*handle, engine);
+        continue;
+      }
+
+      // делим блок пополам, оставляя вторые половины свободными
+      for (auto half = engine.block(*handle).size() / 2; half >= size;
+           half /= 2) {
+        engine.splitFreeBlock(*handle, half);
+      }
+      engine.allocateMemory(*handle, pid, static_cast<int32_t>(size));
+      return;
+    }
+    // подходящего свободного блока нет, игнорируем заявку
+  }
+
+  /**
+   *  @brief Освобождает блок памяти и объединяет его с двойниками.
+   *
+   *  @param pid Идентификатор процесса.
+   *  @param handle Блок памяти, который необходимо освободить.
+   *  @param engine Изменяемое состояние памяти.
+   */
+  template <class Engine>
+  void releaseBuddy(int32_t pid,
+                    typename Engine::BlockHandle handle,
+                    Engine &engine) const {
+    engine.freeMemory(pid, handle);
+
+    while (isBuddyBlock(engine.block(handle))) {
+      auto size = engine.block(handle).size();
+      // двойник первой половины следует за ней, второй - предшествует ей
+      auto isFirstHalf = (engine.block(handle).address() / size) % 2 == 0;
+      auto buddy =
+          isFirstHalf ? engine.nextBlock(handle) : engine.previousBlock(handle);
+      if (!buddy.has_value() || engine.block(*buddy).pid() != -1 ||
+          engine.block(*buddy).size() != size) {
+        return;
+      }
+
+      handle = isFirstHalf ? handle : *buddy;
+      engine.mergeFreeBlocks(handle);
+    }
+  }
+
+  /**
+   *  @brief Делит свободный блок памяти на блоки системы двойников
+   *  наибольшего возможного размера.
+   *
+   *  @param handle Свободный блок памяти.
+   *  @param engine Изменяемое состояние памяти.
+   */
+  template <class Engine>
+  void splitToBuddies(typename Engine::BlockHandle handle,
+                      Engine &engine) const {
+    while (!isBuddyBlock(engine.block(handle))) {
+      auto address = engine.block(handle).address();
+      auto size = engine.block(handle).size();
+
+      // наибольшая степень двойки, не превышающая размер блока, на которую
+      // делится его адрес
+      int32_t piece = 1;
+      while (piece <= size / 2 && address % (piece * 2) == 0) {
+        piece *= 2;
+      }
+      handle = engine.splitFreeBlock(handle, piece);
+    }
   }
 };
 } // namespace MemoryManagement
@@ -0,0 +1,135 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+
+#include <tl/optional.hpp>
+
+#include "page_bitmap.h"
+
+namespace MemoryManagement {
+/**
+ *  @brief Индекс классов размеров свободных блоков памяти по схеме TLSF
+ *  (Two-Level Segregated Fit).
+ *
+ *  Размер блока относится к классу (fl, sl): fl - номер старшего единичного
+ *  бита размера (первый уровень), sl - следующие за ним SL_BITS бит (второй
+ *  уровень). Индекс хранит количество свободных блоков каждого класса и две
+ *  битовые карты непустых классов, поэтому поиск непустого класса выполняется
+ *  за O(1) двумя операциями поиска младшего единичного бита.
+ *
+ *  Номер класса - fl * SL_COUNT + sl, номера классов возрастают вместе с
+ *  размерами блоков.
+ */
+class TlsfIndex {
+public:
+  static constexpr int32_t SL_BITS = 4;
+
+  static constexpr int32_t SL_COUNT = 1 << SL_BITS;
+
+  static constexpr int32_t FL_COUNT = 32;
+
+private:
+  uint32_t _firstLevel = 0;
+
+  std::array<uint32_t, FL_COUNT> _secondLevel{};
+
+  std::array<int32_t, FL_COUNT * SL_COUNT> _counts{};
+
+public:
+  /**
+   *  @brief Возвращает номер класса, к которому относится блок памяти.
+   *
+   *  @param size Размер блока (в страницах).
+   */
+  static int32_t classOf(int64_t size) {
+    auto fl = PageBitmap::highestBit(static_cast<uint64_t>(size));
+    auto sl = fl < SL_BITS ? (size << (SL_BITS - fl)) - SL_COUNT
+                           : (size >> (fl - SL_BITS)) - SL_COUNT;
+    return fl * SL_COUNT + static_cast<int32_t>(sl);
+  }
+
+  /**
+   *  @brief Возвращает номер наименьшего класса, все блоки которого не меньше
+   *  @a size.
+   *
+   *  @param size Требуемый размер блока (в страницах).
+   */
+  static int32_t searchClassOf(int32_t size) {
+    auto fl = PageBitmap::highestBit(static_cast<uint64_t>(size));
+    int64_t rounded = size;
+    if (fl >= SL_BITS) {
+      // округляем размер вверх до границы класса
+      rounded += (int64_t(1) << (fl - SL_BITS)) - 1;
+    }
+    return classOf(rounded);
+  }
+
+  /**
+   *  @brief Добавляет в индекс свободный блок памяти.
+   *
+   *  @param size Размер блока (в страницах).
+   */
+  void insert(int32_t size) {
+    auto index = classOf(size);
+    if (_counts[index]++ == 0) {
+      _secondLevel[index / SL_COUNT] |= uint32_t(1) << (index % SL_COUNT);
+      _firstLevel |= uint32_t(1) << (index / SL_COUNT);
+    }
+  }
+
+  /**
+   *  @brief Удаляет из индекса свободный блок памяти.
+   *
+   *  @param size Размер блока (в страницах).
+   */
+  void erase(int32_t size) {
+    auto index = classOf(size);
+    if (--_counts[index] == 0) {
+      auto fl = index / SL_COUNT;
+      _secondLevel[fl] &= ~(uint32_t(1) << (index % SL_COUNT));
+      if (_secondLevel[fl] == 0) {
+        _firstLevel &= ~(uint32_t(1) << fl);
+      }
+    }
+  }
+
+  /**
+   *  Удаляет из индекса все блоки.
+   */
+  void clear() { *this = TlsfIndex(); }
+
+  /**
+   *  @brief Возвращает количество свободных блоков класса.
+   *
+   *  @param index Номер класса.
+   */
+  int32_t count(int32_t index) const { return _counts[index]; }
+
+  /**
+   *  @brief Ищет наименьший непустой класс, номер которого не меньше
+   *  @a index.
+   *
+   *  @param index Номер класса.
+   *
+   *  @return Номер класса или tl::nullopt, если такого класса нет.
+   */
+  tl::optional<int32_t> findClass(int32_t index) const {
+    auto fl = index / SL_COUNT;
+    auto secondLevel = _secondLevel[fl] & (~uint32_t(0) << (index % SL_COUNT));
+    if (secondLevel != 0) {
+      return fl * SL_COUNT + PageBitmap::lowestBit(secondLevel);
+    }
+
+    if (fl + 1 >= FL_COUNT) {
+      return tl::nullopt;
+    }
+    auto firstLevel = _firstLevel & (~uint32_t(0) << (fl + 1));
+    if (firstLevel == 0) {
+      return tl::nullopt;
+    }
+    fl = PageBitmap::lowestBit(firstLevel);
+    return fl * SL_COUNT + PageBitmap::lowestBit(_secondLevel[fl]);
+  }
+};
+} // namespace MemoryManagement
@@ -4,6 +4,7 @@
 #include <cstdint>
 #include <set>
 #include <tuple>
+#include <utility>
 #include <vector>
 
 #include <nlohmann/json.hpp>
@@ -11,6 +12,89 @@
 #include "exceptions.h"
 
 namespace MemoryManagement {
+/**
+ *  @brief Параметры адресного пространства.
+ *
+ *  Адресное пространство состоит из @a pages страниц по @a pageSize байт.
+ *  По умолчанию адресное пространство разбито на 256 страниц по 4096 байт.
+ */
+class MemoryConfig {
+private:
+  int32_t _pages;
+
+  int32_t _pageSize;
+
+public:
+  static constexpr int32_t DEFAULT_PAGES = 256;
+
+  static constexpr int32_t DEFAULT_PAGE_SIZE = 4096;
+
+  int32_t pages() const { return _pages; }
+
+  int32_t pageSize() const { return _pageSize; }
+
+  /**
+   *  Возвращает размер адресного пространства в байтах.
+   */
+  int64_t bytes() const { return static_cast<int64_t>(_pages) * _pageSize; }
+
+  /**
+   *  @brief Возвращает количество страниц, необходимое для размещения
+   *  заданного количества байт.
+   *
+   *  @param bytes Количество байт.
+   */
+  int32_t toPages(int64_t bytes) const {
+    return static_cast<int32_t>(bytes % _pageSize == 0
+                                    ? bytes / _pageSize
+                                    : (bytes + _pageSize) / _pageSize);
+  }
+
+  /**
+   *  @brief Создает дескриптор параметров адресного пространства.
+   *
+   *  @param pages Количество страниц.
+   *  @param pageSize Размер страницы в байтах.
+   */
+  MemoryConfig(int32_t pages, int32_t pageSize)
+      : _pages(pages), _pageSize(pageSize) {
+    validate(pages, pageSize);
+  }
+
+  MemoryConfig() : MemoryConfig(DEFAULT_PAGES, DEFAULT_PAGE_SIZE) {}
+
+  bool operator==(const MemoryConfig &rhs) const {
+    return _pages == rhs._pages && _pageSize == rhs._pageSize;
+  }
+
+  bool operator!=(const MemoryConfig &rhs) const { return !(*this == rhs); }
+
+  /**
+   *  Возвращает дескриптор в виде JSON-объекта.
+   */
+  nlohmann::json dump() const {
+    return {{"pages", _pages}, {"page_size", _pageSize}};
+  }
+
+  /**
+   *  @brief Проверяет параметры конструктора.
+   *
+   *  @param pages Количество страниц.
+   *  @param pageSize Размер страницы в байтах.
+   *
+   *  @throws MemoryManagement::TypeException Исключение возникает, если
+   *  переданные параметры не соответствуют заданным ограничениям.
+   */
+  static void validate(int32_t pages, int32_t pageSize) {
+    if (pages < 1) {
+      throw TypeException("INVALID_PAGES");
+    }
+    if (pageSize < 1) {
+      throw TypeException("INVALID_PAGE_SIZE");
+    }
+  }
+};
+
 /**
  *  @brief Дескриптор блока памяти.
  *
@@ -26,6 +110,11 @@ private:
   int32_t _size;
 
 public:
+  /**
+   *  Наибольший допустимый идентификатор процесса.
+   */
+  static constexpr int32_t MAX_PID = 255;
+
   int32_t pid() const { return _pid; }
 
   int32_t address() const { return _address; }
@@ -38,10 +127,14 @@ public:
    *  @param pid Идентификатор процесса, которому выделен данный блок, или -1.
    *  @param address Адрес начала блока (в страницах).
    *  @param size Размер блока (в страницах).
+   *  @param pages Количество страниц в адресном пространстве.
    */
-  MemoryBlock(int32_t pid, int32_t address, int32_t size)
+  MemoryBlock(int32_t pid,
+              int32_t address,
+              int32_t size,
+              int32_t pages = MemoryConfig::DEFAULT_PAGES)
       : _pid(pid), _address(address), _size(size) {
-    validate(pid, address, size);
+    validate(pid, address, size, pages);
   }
 
   MemoryBlock(const MemoryBlock &other) = default;
@@ -72,21 +165,25 @@ public:
    *  @param pid Идентификатор процесса, которому выделен данный блок, или -1.
    *  @param address Адрес начала блока (в страницах).
    *  @param size Размер блока (в страницах).
+   *  @param pages Количество страниц в адресном пространстве.
    *
    *  @throws MemoryManagement::TypeException Исключение возникает, если
    *  переданные параметры не соответствуют заданным ограничениям.
    */
-  static void validate(int32_t pid, int32_t address, int32_t size) {
-    if (pid < -1 || pid > 255) {
+  static void validate(int32_t pid,
+                       int32_t address,
+                       int32_t size,
+                       int32_t pages = MemoryConfig::DEFAULT_PAGES) {
+    if (pid < -1 || pid > MAX_PID) {
       throw TypeException("INVALID_PID");
     }
-    if (address < 0 || address > 255) {
+    if (address < 0 || address > pages - 1) {
       throw TypeException("INVALID_ADDRESS");
     }
-    if (size < 1 || size > 256) {
+    if (size < 1 || size > pages) {
       throw TypeException("INVALID_SIZE");
     }
-    if (address + size > 256) {
+    if (static_cast<int64_t>(address) + size > pages) {
       throw TypeException("OUT_OF_BOUNDS");
     }
   }
@@ -95,7 +192,8 @@ public:
 /**
  *  @brief Дескриптор состояния памяти.
  *
- *  В данной модели адресное пространство разбито на 256 страниц по 4096 байт.
+ *  В данной модели адресное пространство разбито на страницы одинакового
+ *  размера (по умолчанию 256 страниц по 4096 байт, см. MemoryConfig).
  *  Наименьшая единица адресного пространства, доступная для выделения процессу
  *  - страница. Выделять можно только целое число страниц.
  *
@@ -112,7 +210,7 @@ public:
  *
  *  Под начальным состоянием памяти подразумевается такое состояние памяти, при
  *  котором все адресное пространство покрыто одним свободным блоком памяти с
- *  начальным адресом 0 и размером 256.
+ *  начальным адресом 0 и размером, равным количеству страниц.
  *
  *  Программная модель разработана исходя из того, что перед обработкой первой
  *  заявки память находится в начальном состоянии.
@@ -123,16 +221,21 @@ public:
 
   std::vector<MemoryBlock> freeBlocks;
 
+  MemoryConfig config;
+
   /**
    *  @brief Создает дескриптор состояния памяти с заданными параметрами.
    *
    *  @param blocks Массив из дескрипторов всех доступных блоков памяти.
    *  @param freeBlocks Массив из дескрипторов свободных блоков памяти,
    *  упорядоченных согласно стратегии.
+   *  @param config Параметры адресного пространства.
    */
-  MemoryState(const std::vector<MemoryBlock> &blocks,
-              const std::vector<MemoryBlock> &freeBlocks)
-      : blocks(blocks), freeBlocks(freeBlocks) {}
+  MemoryState(std::vector<MemoryBlock> blocks,
+              std::vector<MemoryBlock> freeBlocks,
+              const MemoryConfig &config = MemoryConfig())
+      : blocks(std::move(blocks)), freeBlocks(std::move(freeBlocks)),
+        config(config) {}
 
   MemoryState() : MemoryState(MemoryState::initial()) {}
 
@@ -145,7 +248,8 @@ public:
   MemoryState &operator=(MemoryState &&state) = default;
 
   bool operator==(const MemoryState &state) const {
-    return blocks == state.blocks && freeBlocks == state.freeBlocks;
+    return blocks == state.blocks && freeBlocks == state.freeBlocks &&
+           config == state.config;
   }
 
   bool operator!=(const MemoryState &state) const { return !(*this == state); }
@@ -168,10 +272,15 @@ public:
   }
 
   /**
-   *  Возвращает дескриптор с начальным состоянием.
+   *  @brief Возвращает дескриптор с начальным состоянием.
+   *
+   *  @param config Параметры адресного пространства.
    */
-  static MemoryState initial() {
-    return {{MemoryBlock{-1, 0, 256}}, {MemoryBlock{-1, 0, 256}}};
+  static MemoryState initial(const MemoryConfig &config = MemoryConfig()) {
+    auto pages = config.pages();
+    return {{MemoryBlock{-1, 0, pages, pages}},
+            {MemoryBlock{-1, 0, pages, pages}},
+            config};
   }
 
   /**
@@ -180,12 +289,14 @@ public:
    *  @param blocks Массив из дескрипторов всех доступных блоков памяти.
    *  @param freeBlocks Массив из дескрипторов свободных блоков памяти,
    *  упорядоченных согласно стратегии.
+   *  @param config Параметры адресного пространства.
    *
    *  @throws MemoryManagement::TypeException Исключение возникает, если
    *  переданные параметры не соответствуют заданным ограничениям.
    */
   static void validate(const std::vector<MemoryBlock> &blocks,
-                       const std::vector<MemoryBlock> &freeBlocks) {
+                       const std::vector<MemoryBlock> &freeBlocks,
+                       const MemoryConfig &config = MemoryConfig()) {
     if (blocks.size() == 0 && freeBlocks.size() == 0) {
       throw TypeException("INVALID_STATE");
     }
@@ -223,7 +334,7 @@ public:
     // Последний блок должен полностью покрыть оставшееся пространство, при этом
     // не выходя за его границы.
     auto &last = blocks.back();
-    if (last.address() + last.size() > 256) {
+    if (static_cast<int64_t>(last.address()) + last.size() > config.pages()) {
       throw TypeException("INVALID_STATE");
     }
   }
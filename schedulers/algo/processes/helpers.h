@@ -3,11 +3,11 @@
 #include <algorithm>
 #include <cstddef>
 #include <cstdint>
-#include <vector>
 
 #include <tl/optional.hpp>
 
 #include "types.h"
+#include "views.h"
 
 namespace ProcessesManagement {
 /**
@@ -20,9 +20,8 @@ namespace ProcessesManagement {
  *  @return Индекс (tl::optional) искомого дескриптора или tl::nullopt,
  *  если процесса с таким @a pid не существует.
  */
-inline tl::optional<std::size_t>
-getIndexByPid(const std::vector<Process> &processes, int32_t pid) {
-
+inline tl::optional<std::size_t> getIndexByPid(ProcessesView processes,
+                                               int32_t pid) {
   auto pos =
       std::find_if(processes.begin(),
                    processes.end(),
@@ -39,6 +38,8 @@ getIndexByPid(const std::vector<Process> &processes, int32_t pid) {
  *  @brief Находит индекс дескриптора процесса с заданным идентификатором
  * процесса.
  *
+ *  Поиск выполняется за O(1) по индексу дескриптора состояния процессов.
+ *
  *  @param state Дескриптор состояния процессов.
  *  @param pid Идентификатор процесса.
  *
@@ -47,7 +48,7 @@ getIndexByPid(const std::vector<Process> &processes, int32_t pid) {
  */
 inline tl::optional<std::size_t> getIndexByPid(const ProcessesState &state,
                                                int32_t pid) {
-  return getIndexByPid(state.processes, pid);
+  return state.indexOf(pid);
 }
 
 /**
@@ -60,8 +61,8 @@ inline tl::optional<std::size_t> getIndexByPid(const ProcessesState &state,
  *  @return Индекс (tl::optional) искомого дескриптора или tl::nullopt,
  *  если процесса с таким @a pid не существует.
  */
-inline tl::optional<std::size_t>
-getIndexByState(const std::vector<Process> &processes, ProcState state) {
+inline tl::optional<std::size_t> getIndexByState(ProcessesView processes,
+                                                 ProcState state) {
   auto pos = std::find_if(
       processes.begin(), processes.end(), [state](const auto &process) {
         return process.state() == state;
@@ -78,6 +79,9 @@ getIndexByState(const std::vector<Process> &processes, ProcState state) {
  *  @brief Находит индекс первого по списку дескриптора процесса с заданным
  * состоянием процесса.
  *
+ *  Выполняющийся процесс (ProcState::EXECUTING) находится за O(1) по индексу
+ *  дескриптора состояния процессов, остальные - перебором.
+ *
  *  @param state Дескриптор состояния процессов.
  *  @param procState Состояние процесса.
  *
@@ -86,6 +90,9 @@ getIndexByState(const std::vector<Process> &processes, ProcState state) {
  */
 inline tl::optional<std::size_t> getIndexByState(const ProcessesState &state,
                                                  ProcState procState) {
+  if (procState == ProcState::EXECUTING) {
+    return state.executingIndex();
+  }
   return getIndexByState(state.processes, procState);
 }
 } // namespace ProcessesManagement
@@ -1,11 +1,8 @@
 #pragma once
 
-#include <algorithm>
 #include <cstddef>
 #include <cstdint>
-#include <functional>
-#include <map>
-#include <set>
+#include <utility>
 #include <vector>
 
 #include "exceptions.h"
@@ -27,14 +24,14 @@ namespace ProcessesManagement {
  *
  *  "NO_SUCH_PROCESS" - процесса с таким @a pid не существует.
  */
-inline ProcessesState changeProcessState(const ProcessesState &state,
+inline ProcessesState changeProcessState(ProcessesState state,
                                          int32_t pid,
                                          ProcState newState) {
-  auto [processes, queues] = state;
+  auto result = std::move(state);
 
-  if (auto index = getIndexByPid(processes, pid); index.has_value()) {
-    processes.at(*index) = processes.at(*index).state(newState);
-    return {processes, queues};
+  if (auto index = getIndexByPid(result, pid); index.has_value()) {
+    result.setProcess(*index, result.processes.at(*index).state(newState));
+    return result;
   } else {
     throw OperationException("NO_SUCH_PROCESS");
   }
@@ -56,18 +53,17 @@ inline ProcessesState changeProcessState(const ProcessesState &state,
  *  "ALREADY_IN_QUEUE" - процесс уже добавлен в одну из очередей.
  */
 inline ProcessesState
-pushToQueue(const ProcessesState &state, size_t queueIndex, int32_t pid) {
-  auto [processes, queues] = state;
+pushToQueue(ProcessesState state, size_t queueIndex, int32_t pid) {
+  auto newState = std::move(state);
 
-  if (auto index = getIndexByPid(processes, pid); index.has_value()) {
-    for (const auto &queue : queues) {
-      if (std::find(queue.begin(), queue.end(), pid) != queue.end()) {
-        throw OperationException("ALREADY_IN_QUEUE");
-      }
+  if (auto index = getIndexByPid(newState, pid); index.has_value()) {
+    if (newState.queueOf(pid).has_value()) {
+      throw OperationException("ALREADY_IN_QUEUE");
     }
-    queues.at(queueIndex).push_back(pid);
-    processes.at(*index) = processes.at(*index).priority(queueIndex);
-    return {processes, queues};
+    newState.enqueue(queueIndex, pid);
+    const auto &process = newState.processes.at(*index);
+    newState.setProcess(*index, process.priority(queueIndex, newState.config));
+    return newState;
   } else {
     throw OperationException("NO_SUCH_PROCESS");
   }
@@ -88,22 +84,22 @@ pushToQueue(const ProcessesState &state, size_t queueIndex, int32_t pid) {
  *  "NO_SUCH_PROCESS" - процесса с @a pid нет в очереди с индексом @a
  *  queueIndex.
  */
-inline ProcessesState popFromQueue(const ProcessesState &state,
+inline ProcessesState popFromQueue(ProcessesState state,
                                    size_t queueIndex) {
-  auto [processes, queues] = state;
+  auto newState = std::move(state);
 
-  auto &queue = queues.at(queueIndex);
+  const auto &queue = newState.queues.at(queueIndex);
   if (queue.empty()) {
     throw OperationException("EMPTY_QUEUE");
   }
 
   auto pid = queue.front();
 
-  if (auto index = getIndexByPid(processes, pid); !index.has_value()) {
+  if (auto index = getIndexByPid(newState, pid); !index.has_value()) {
     throw OperationException("NO_SUCH_PROCESS");
   }
-  queue.pop_front();
-  return {processes, queues};
+  newState.dequeue(queueIndex);
+  return newState;
 }
 
 /**
@@ -121,32 +117,32 @@ inline ProcessesState popFromQueue(const ProcessesState &state,
  *  "INVALID_STATE" - процесс с @a newPid не находится в состоянии
  *  ProcState::ACTIVE.
  */
-inline ProcessesState switchTo(const ProcessesState &state, int32_t nextPid) {
-  auto [processes, queues] = state;
+inline ProcessesState switchTo(ProcessesState state, int32_t nextPid) {
+  auto newState = std::move(state);
 
-  auto prevIndex = getIndexByState(processes, ProcState::EXECUTING);
-  auto nextIndex = getIndexByPid(processes, nextPid);
+  auto prevIndex = getIndexByState(newState, ProcState::EXECUTING);
+  auto nextIndex = getIndexByPid(newState, nextPid);
 
   if (!nextIndex.has_value()) {
     throw OperationException("NO_SUCH_PROCESS");
   }
 
-  auto next = processes.at(*nextIndex);
+  auto next = newState.processes.at(*nextIndex);
   if (prevIndex.has_value()) {
-    auto prev = processes.at(*prevIndex);
+    auto prev = newState.processes.at(*prevIndex);
     if (prev == next) {
-      return state;
+      return newState;
     } else {
-      processes.at(*prevIndex) = prev.state(ProcState::ACTIVE);
+      newState.setProcess(*prevIndex, prev.state(ProcState::ACTIVE));
     }
 
     if (next.state() != ProcState::ACTIVE) {
       throw OperationException("INVALID_STATE");
     }
   }
-  processes.at(*nextIndex) = next.state(ProcState::EXECUTING);
+  newState.setProcess(*nextIndex, next.state(ProcState::EXECUTING));
 
-  return {processes, queues};
+  return newState;
 }
 
 /**
@@ -164,53 +160,20 @@ inline ProcessesState switchTo(const ProcessesState &state, int32_t nextPid) {
  *
  *  "NO_SUCH_PROCESS" - процесса с таким @a pid не существует.
  */
-inline ProcessesState terminateProcess(const ProcessesState &state,
+inline ProcessesState terminateProcess(ProcessesState state,
                                        int32_t pid,
                                        bool terminateChildren = true) {
-  auto [processes, queues] = state;
-
-  if (auto index = getIndexByPid(processes, pid); !index.has_value()) {
+  if (auto index = getIndexByPid(state, pid); !index.has_value()) {
     throw OperationException("NO_SUCH_PROCESS");
   }
 
-  std::map<int32_t, std::vector<int32_t>> parents;
-  for (const auto &process : processes) {
-    if (process.ppid() != -1) {
-      parents[process.ppid()].push_back(process.pid());
-    }
-  }
-  std::set<int32_t> toTerminate;
-  std::function<void(int32_t)> rec =
-      [&rec, &toTerminate, &parents](int32_t pid) {
-        toTerminate.insert(pid);
-        for (const auto &child : parents[pid]) {
-          rec(child);
-        }
-      };
+  auto newState = std::move(state);
   if (terminateChildren) {
-    rec(pid);
+    newState.removeProcesses(newState.subtree(pid));
   } else {
-    toTerminate.insert(pid);
-  }
-
-  decltype(processes) newProcesses;
-  decltype(queues) newQueues;
-
-  for (const auto &process : processes) {
-    if (toTerminate.find(process.pid()) == toTerminate.end()) {
-      newProcesses.push_back(process);
-    }
+    newState.removeProcesses({pid});
   }
-  for (size_t i = 0; i < queues.size(); ++i) {
-    const auto &queue = queues[i];
-    auto &newQueue = newQueues[i];
-    for (const auto &pid : queue) {
-      if (toTerminate.find(pid) == toTerminate.end()) {
-        newQueue.push_back(pid);
-      }
-    }
-  }
-  return {newProcesses, newQueues};
+  return newState;
 }
 
 /**
@@ -227,22 +190,20 @@ inline ProcessesState terminateProcess(const ProcessesState &state,
  *  "PROCESS_EXISTS" - процесс с таким идентификатором уже есть;
  *  "NO_SUCH_PPID" - родительского процесса не существует.
  */
-inline ProcessesState addProcess(const ProcessesState &state, Process process) {
-  auto [processes, queues] = state;
-
-  if (auto index = getIndexByPid(processes, process.pid()); index.has_value()) {
+inline ProcessesState addProcess(ProcessesState state, Process process) {
+  if (auto index = getIndexByPid(state, process.pid()); index.has_value()) {
     throw OperationException("PROCESS_EXISTS");
   }
 
-  auto parentIndex = getIndexByPid(processes, process.ppid());
+  auto parentIndex = getIndexByPid(state, process.ppid());
   if (process.ppid() != -1 && !parentIndex.has_value()) {
     throw OperationException("NO_SUCH_PPID");
   }
 
-  processes.push_back(process);
-  std::sort(processes.begin(), processes.end());
+  auto newState = std::move(state);
+  newState.insertProcess(process);
 
-  return {processes, queues};
+  return newState;
 }
 
 /**
@@ -252,15 +213,15 @@ inline ProcessesState addProcess(const ProcessesState &state, Process process) {
  *
  *  @return Новое состояние процессов.
  */
-inline ProcessesState updateTimer(const ProcessesState &state) {
-  auto [processes, queues] = state;
+inline ProcessesState updateTimer(ProcessesState state) {
+  auto newState = std::move(state);
 
-  if (auto index = getIndexByState(processes, ProcState::EXECUTING);
+  if (auto index = getIndexByState(newState, ProcState::EXECUTING);
       index.has_value()) {
-    auto current = processes.at(*index);
-    processes.at(*index) = current.timer(current.timer() + 1);
+    auto current = newState.processes.at(*index);
+    newState.setProcess(*index, current.timer(current.timer() + 1));
   }
 
-  return {processes, queues};
+  return newState;
 }
 } // namespace ProcessesManagement
@@ -38,6 +38,7 @@ public:
    *  @param basePriority Базовый приоритет процесса.
    *  @param timer Время работы.
    *  @param workTime Заявленное время работы.
+   *  @param config Параметры модели процессов.
    *
    *  @throws ProcessesManagement::RequestException Исключение возникает, если
    *  переданные параметры не соответствуют заданным ограничениям.
@@ -47,19 +48,20 @@ public:
                    size_t priority = 0,
                    size_t basePriority = 0,
                    int32_t timer = 0,
-                   int32_t workTime = 0)
+                   int32_t workTime = 0,
+                   const ProcessesConfig &config = ProcessesConfig())
       : _pid(pid), _ppid(ppid), _priority(priority),
         _basePriority(basePriority), _timer(timer), _workTime(workTime) {
-    if (pid < 0 || pid > 255) {
+    if (pid < 0 || pid > config.maxPid()) {
       throw RequestException("INVALID_PID");
     }
-    if (ppid < -1 || ppid > 255) {
+    if (ppid < -1 || ppid > config.maxPid()) {
       throw RequestException("INVALID_PPID");
     }
-    if (priority > 15) {
+    if (priority > config.maxPriority()) {
       throw RequestException("INVALID_PRIORITY");
     }
-    if (basePriority > 15 || basePriority > priority) {
+    if (basePriority > config.maxPriority() || basePriority > priority) {
       throw RequestException("INVALID_BASE_PRIORITY");
     }
     if (timer < 0) {
@@ -96,14 +98,16 @@ public:
   }
 
   /**
-   *  Возвращает дескриптор процесса, описанного в заявке.
+   *  @brief Возвращает дескриптор процесса, описанного в заявке.
+   *
+   *  @param config Параметры модели процессов.
    */
-  Process toProcess() const {
+  Process toProcess(const ProcessesConfig &config = ProcessesConfig()) const {
     return Process{}
-        .pid(pid())
-        .ppid(ppid())
-        .priority(priority())
-        .basePriority(basePriority())
+        .pid(pid(), config)
+        .ppid(ppid(), config)
+        .priority(priority(), config)
+        .basePriority(basePriority(), config)
         .timer(timer())
         .workTime(workTime());
   }
@@ -121,12 +125,15 @@ public:
    *  @brief Создает заявку на завершение существующего процесса.
    *
    *  @param pid Идентификатор процесса.
+   *  @param config Параметры модели процессов.
    *
    *  @throws ProcessesManagement::RequestException Исключение возникает, если
    *  переданные параметры не соответствуют заданным ограничениям.
    */
-  TerminateProcessReq(int32_t pid) : _pid(pid) {
-    if (pid < 0 || pid > 255) {
+  TerminateProcessReq(int32_t pid,
+                      const ProcessesConfig &config = ProcessesConfig())
+      : _pid(pid) {
+    if (pid < 0 || pid > config.maxPid()) {
       throw RequestException("INVALID_PID");
     }
   }
@@ -153,12 +160,14 @@ public:
    *  @brief Создает заявку на инициализацию ввода/вывода.
    *
    *  @param pid Идентификатор процесса.
+   *  @param config Параметры модели процессов.
    *
    *  @throws ProcessesManagement::RequestException Исключение возникает, если
    *  переданные параметры не соответствуют заданным ограничениям.
    */
-  InitIO(int32_t pid) : _pid(pid) {
-    if (pid < 0 || pid > 255) {
+  InitIO(int32_t pid, const ProcessesConfig &config = ProcessesConfig())
+      : _pid(pid) {
+    if (pid < 0 || pid > config.maxPid()) {
       throw RequestException("INVALID_PID");
     }
   }
@@ -186,16 +195,20 @@ public:
    *
    *  @param pid Идентификатор процесса.
    *  @param augment Прибавка к текущему приоритету (только для WinNT).
+   *  @param config Параметры модели процессов.
    *
    *  @throws ProcessesManagement::RequestException Исключение возникает, если
    *  переданные параметры не соответствуют заданным ограничениям.
    */
-  TerminateIO(int32_t pid, size_t augment = 1) : _pid(pid), _augment(augment) {
-    if (pid < 0 || pid > 255) {
+  TerminateIO(int32_t pid,
+              size_t augment = 1,
+              const ProcessesConfig &config = ProcessesConfig())
+      : _pid(pid), _augment(augment) {
+    if (pid < 0 || pid > config.maxPid()) {
       throw RequestException("INVALID_PID");
     }
 
-    if (augment < 1 || augment > 15) {
+    if (augment < 1 || augment > config.maxPriority()) {
       throw RequestException("INVALID_AUGMENT");
     }
   }
@@ -224,12 +237,15 @@ public:
    *  @brief Создает заявку передачу управления операционной системе.
    *
    *  @param pid Идентификатор процесса.
+   *  @param config Параметры модели процессов.
    *
    *  @throws ProcessesManagement::RequestException Исключение возникает, если
    *  переданные параметры не соответствуют заданным ограничениям.
    */
-  TransferControl(int32_t pid) : _pid(pid) {
-    if (pid < 0 || pid > 255) {
+  TransferControl(int32_t pid,
+                  const ProcessesConfig &config = ProcessesConfig())
+      : _pid(pid) {
+    if (pid < 0 || pid > config.maxPid()) {
       throw RequestException("INVALID_PID");
     }
   }
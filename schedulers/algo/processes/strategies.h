@@ -1,10 +1,12 @@
 #pragma once
 
 #include "strategies/abstract.h"
+#include "strategies/cfs.h"
 #include "strategies/fcfs.h"
 #include "strategies/linuxo1.h"
 #include "strategies/roundrobin.h"
 #include "strategies/sjn.h"
 #include "strategies/srt.h"
+#include "strategies/static.h"
 #include "strategies/unix.h"
 #include "strategies/winnt.h"
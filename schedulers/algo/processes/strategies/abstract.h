@@ -12,10 +12,20 @@
 #include "../operations.h"
 #include "../requests.h"
 #include "../types.h"
+#include "../views.h"
 
 namespace ProcessesManagement {
 
-enum class StrategyType { ROUNDROBIN, FCFS, SJN, SRT, WINDOWS, UNIX, LINUXO1 };
+enum class StrategyType {
+  ROUNDROBIN,
+  FCFS,
+  SJN,
+  SRT,
+  WINDOWS,
+  UNIX,
+  LINUXO1,
+  CFS
+};
 
 /**
  * @brief Базовый класс для всех стратегий.
@@ -41,13 +51,90 @@ public:
    *
    *  @return Новое состояние процессов.
    */
+  ProcessesState processRequest(const Request &request,
+                                const ProcessesState &state) const {
+    return processRequest(request, ProcessesState(state));
+  }
+
+  /**
+   *  @brief Обрабатывает заявку любого типа, забирая состояние процессов.
+   *
+   *  Состояние передается обработчику заявки и всем операциям перемещением,
+   *  поэтому при обработке заявки оно не копируется.
+   *
+   *  @param request Заявка.
+   *  @param state Дескриптор состояния процессов.
+   *
+   *  @return Новое состояние процессов.
+   */
   virtual ProcessesState processRequest(const Request &request,
-                                        const ProcessesState &state) const {
-    return request.match([this, state](const auto &req) {
-      return updateTimer(this->processRequest(req, state));
+                                        ProcessesState &&state) const {
+    return request.match([this, &state](const auto &req) {
+      return updateTimer(this->processRequest(req, std::move(state)));
     });
   }
 
+  /**
+   *  @brief Обрабатывает последовательность заявок.
+   *
+   *  Состояние процессов передается от заявки к заявке перемещением и не
+   *  копируется. После каждой заявки вызывается @a callback с номером заявки
+   *  в последовательности и текущим состоянием процессов; снимок состояния
+   *  создается, только если @a callback копирует его.
+   *
+   *  @param first Итератор, указывающий на первую заявку.
+   *  @param last Итератор, указывающий за последнюю заявку.
+   *  @param state Начальное состояние процессов.
+   *  @param callback Функция вида void(std::size_t, const ProcessesState &).
+   *
+   *  @return Состояние процессов после обработки всех заявок.
+   */
+  template <class Iterator, class Callback>
+  ProcessesState processRequests(Iterator first,
+                                 Iterator last,
+                                 ProcessesState state,
+                                 Callback callback) const {
+    for (std::size_t index = 0; first != last; ++first, ++index) {
+      state = processRequest(*first, std::move(state));
+      callback(index, static_cast<const ProcessesState &>(state));
+    }
+    return state;
+  }
+
+  /**
+   *  @brief Обрабатывает последовательность заявок.
+   *
+   *  @param first Итератор, указывающий на первую заявку.
+   *  @param last Итератор, указывающий за последнюю заявку.
+   *  @param state Начальное состояние процессов.
+   *
+   *  @return Состояние процессов после обработки всех заявок.
+   */
+  template <class Iterator>
+  ProcessesState
+  processRequests(Iterator first, Iterator last, ProcessesState state) const {
+    return processRequests(first,
+                           last,
+                           std::move(state),
+                           [](std::size_t, const ProcessesState &) {});
+  }
+
+  /**
+   *  @brief Проверяет, что состояние процессов удовлетворяет ограничениям
+   *  стратегии (например, порядку процессов в очередях).
+   *
+   *  Обработчики заявок полагаются на эти ограничения и не проверяют их,
+   *  поэтому проверка выполняется один раз при загрузке задания. Состояния,
+   *  полученные обработкой заявок стратегией из начального состояния,
+   *  удовлетворяют ее ограничениям.
+   *
+   *  @param state Представление состояния процессов.
+   *
+   *  @throws ProcessesManagement::TypeException Исключение возникает, если
+   *  состояние не удовлетворяет ограничениям стратегии.
+   */
+  virtual void validateState(StateView) const {}
+
   /**
    *  @brief Возвращает текстовое описание заявки.
    *
@@ -107,7 +194,7 @@ protected:
    *  @return Новое состояние процессов.
    */
   virtual ProcessesState processRequest(const CreateProcessReq &request,
-                                        const ProcessesState &state) const = 0;
+                                        ProcessesState state) const = 0;
 
   /**
    *  @brief Обрабатывает заявку завершение существующего процесса.
@@ -118,7 +205,7 @@ protected:
    *  @return Новое состояние процессов.
    */
   virtual ProcessesState processRequest(const TerminateProcessReq &request,
-                                        const ProcessesState &state) const = 0;
+                                        ProcessesState state) const = 0;
 
   /**
    *  @brief Обрабатывает заявку на инициализацию ввода/вывода.
@@ -129,7 +216,7 @@ protected:
    *  @return Новое состояние процессов.
    */
   virtual ProcessesState processRequest(const InitIO &request,
-                                        const ProcessesState &state) const = 0;
+                                        ProcessesState state) const = 0;
 
   /**
    *  @brief Обрабатывает заявку на завершение ввода/вывода.
@@ -140,7 +227,7 @@ protected:
    *  @return Новое состояние процессов.
    */
   virtual ProcessesState processRequest(const TerminateIO &request,
-                                        const ProcessesState &state) const = 0;
+                                        ProcessesState state) const = 0;
 
   /**
    *  @brief Обрабатывает заявку на передачу управления операционной системе.
@@ -151,7 +238,7 @@ protected:
    *  @return Новое состояние процессов.
    */
   virtual ProcessesState processRequest(const TransferControl &request,
-                                        const ProcessesState &state) const = 0;
+                                        ProcessesState state) const = 0;
 
   /**
    *  @brief Обрабатывает заявку "Истек квант вермени".
@@ -162,34 +249,80 @@ protected:
    *  @return Новое состояние процессов.
    */
   virtual ProcessesState processRequest(const TimeQuantumExpired &request,
-                                        const ProcessesState &state) const = 0;
+                                        ProcessesState state) const = 0;
 
   /**
    *  @brief Выбирает процесс, которому будет предоставлено процессорное время.
    *
-   *  @param state Дескриптор состояния процессов.
+   *  @param state Представление состояния процессов.
    *
    *  @return Кортеж из двух чисел: PID процесса и индекс очереди, в которой он
    *  находится; либо tl::nullopt, если такового нет.
    */
   virtual tl::optional<std::pair<int32_t, size_t>>
-  schedule(const ProcessesState &state) const = 0;
+  schedule(StateView state) const = 0;
 
   /**
    * @brief Возвращает дескриптор процесса, который выполняется в данный момент.
    *
-   * @param state Дескриптор состояния процессов.
+   * Ссылка действительна, пока состояние процессов не изменено.
+   *
+   * @param state Представление состояния процессов.
+   *
+   * @return Ссылка на дескриптор процесса или tl::nullopt, если такового нет.
+   */
+  tl::optional<const Process &> getCurrent(StateView state) const {
+    return state.current();
+  }
+};
+
+/**
+ *  @brief Базовый класс стратегий со статической диспетчеризацией заявок.
+ *
+ *  Метод dispatch() передает заявку обработчику стратегии @a Strategy без
+ *  виртуальных вызовов, поэтому компилятор может встроить обработчики и выбор
+ *  следующего процесса (schedule()) в код диспетчеризации. Виртуальный метод
+ *  processRequest() интерфейса AbstractStrategy вызывает dispatch().
+ *
+ *  Стратегия @a Strategy объявляет StrategyBase<Strategy> дружественным
+ *  классом, чтобы dispatch() имел доступ к ее обработчикам заявок, и может
+ *  скрыть метод beforeRequest() собственным.
+ */
+template <class Strategy> class StrategyBase : public AbstractStrategy {
+public:
+  using AbstractStrategy::processRequest;
+
+  ProcessesState processRequest(const Request &request,
+                                ProcessesState &&state) const override {
+    return dispatch(request, std::move(state));
+  }
+
+  /**
+   *  @brief Обрабатывает заявку любого типа без виртуальных вызовов.
+   *
+   *  @param request Заявка.
+   *  @param state Дескриптор состояния процессов.
    *
-   * @return Дескриптор процесса или tl::nullopt, если такового нет.
+   *  @return Новое состояние процессов.
    */
-  tl::optional<Process> getCurrent(const ProcessesState &state) const {
-    if (auto index = getIndexByState(state.processes, ProcState::EXECUTING);
-        index.has_value()) {
-      return state.processes.at(*index);
-    } else {
-      return tl::nullopt;
-    };
+  ProcessesState dispatch(const Request &request, ProcessesState state) const {
+    const auto &strategy = static_cast<const Strategy &>(*this);
+    auto newState = strategy.beforeRequest(std::move(state));
+    return request.match([&strategy, &newState](const auto &req) {
+      return updateTimer(
+          strategy.Strategy::processRequest(req, std::move(newState)));
+    });
   }
+
+protected:
+  /**
+   *  @brief Подготавливает состояние процессов к обработке заявки.
+   *
+   *  @param state Дескриптор состояния процессов.
+   *
+   *  @return Новое состояние процессов.
+   */
+  ProcessesState beforeRequest(ProcessesState state) const { return state; }
 };
 
 using StrategyPtr = std::shared_ptr<AbstractStrategy>;
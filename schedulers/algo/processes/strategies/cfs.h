@@ -0,0 +1,318 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <utility>
+
+#include <tl/optional.hpp>
+
+#include "../exceptions.h"
+#include "../operations.h"
+#include "abstract.h"
+
+namespace ProcessesManagement {
+/**
+ *  @brief Стратегия "CFS" (Completely Fair Scheduler).
+ *
+ *  Процессорное время предоставляется процессу с наименьшим виртуальным
+ *  временем выполнения: значением таймера процесса, деленным на его вес. Вес
+ *  определяется приоритетом так же, как в Linux по значению nice: приоритет 0
+ *  соответствует nice 0, каждый следующий уровень - на единицу меньшему nice.
+ *
+ *  Процесс находится в очереди, номер которой равен его приоритету. Внутри
+ *  очереди у всех процессов один и тот же вес, поэтому очередь упорядочена по
+ *  таймеру (при равенстве - в порядке поступления) и ее первый процесс имеет
+ *  наименьшее виртуальное время среди процессов этого приоритета. Выбор
+ *  следующего процесса сравнивает только первые процессы непустых очередей.
+ *
+ *  В отличие от Linux, виртуальное время не ограничивается снизу наименьшим
+ *  временем среди готовых процессов: таймер процесса - наблюдаемое время его
+ *  выполнения, и стратегия его не изменяет. Поэтому новый процесс (с таймером
+ *  0) и процесс, вернувшийся после ввода/вывода, опережают долго работающие
+ *  процессы, и непрерывный поток новых процессов может бесконечно
+ *  откладывать их выполнение.
+ */
+class CfsStrategy final : public StrategyBase<CfsStrategy> {
+public:
+  StrategyType type() const override { return StrategyType::CFS; }
+
+  std::string toString() const override { return "CFS"; }
+
+  static std::shared_ptr<CfsStrategy> create() {
+    return std::shared_ptr<CfsStrategy>(new CfsStrategy());
+  }
+
+  std::string getRequestDescription(const Request &request) const override {
+    using ss = std::stringstream;
+
+    auto base = AbstractStrategy::getRequestDescription(request);
+
+    if (request.is<CreateProcessReq>()) {
+      auto req = request.get<CreateProcessReq>();
+      return static_cast<const ss &>(ss() << base << ". "
+                                          << "Приоритет: " << req.priority())
+          .str();
+    } else {
+      return base;
+    }
+  }
+
+  /**
+   *  @brief Возвращает вес процесса с заданным приоритетом.
+   *
+   *  @param priority Приоритет процесса.
+   */
+  static int64_t weight(std::size_t priority) {
+    // Веса для nice от 0 до -20 (kernel/sched/core.c)
+    static constexpr std::array<int64_t, 21> weights = {
+        1024,  1277,  1586,  1991,  2501,  3121,  3906,
+        4904,  6100,  7620,  9548,  11916, 14949, 18705,
+        23254, 29154, 36291, 46273, 56483, 71755, 88761};
+    return weights[std::min(priority, weights.size() - 1)];
+  }
+
+  /**
+   *  @brief Сравнивает виртуальное время выполнения двух процессов.
+   *
+   *  @return true, если виртуальное время процесса @a lhs меньше, чем у
+   *  процесса @a rhs.
+   */
+  static bool lessVruntime(const Process &lhs, const Process &rhs) {
+    return lhs.timer() * weight(rhs.priority()) <
+           rhs.timer() * weight(lhs.priority());
+  }
+
+  /**
+   *  @brief Проверяет, что каждая очередь упорядочена по таймеру.
+   *
+   *  @see AbstractStrategy::validateState().
+   */
+  void validateState(StateView state) const override {
+    for (std::size_t queueIndex = 0; queueIndex < state.queuesCount();
+         ++queueIndex) {
+      tl::optional<int32_t> previous;
+      for (auto pid : state.queue(queueIndex)) {
+        auto process = state.process(pid);
+        if (!process.has_value() ||
+            (previous.has_value() && process->timer() < *previous)) {
+          throw TypeException("INVALID_STATE");
+        }
+        previous = process->timer();
+      }
+    }
+  }
+
+protected:
+  tl::optional<std::pair<int32_t, size_t>>
+  schedule(StateView state) const override {
+    const Process *best = nullptr;
+    std::size_t bestQueue = 0;
+    // При равном виртуальном времени выбирается процесс с большим приоритетом
+    for (auto queueIndex = state.queuesCount(); queueIndex-- > 0;) {
+      auto queue = state.queue(queueIndex);
+      if (queue.empty()) {
+        continue;
+      }
+      const auto &process = *state.process(queue.front());
+      if (best == nullptr || lessVruntime(process, *best)) {
+        best = &process;
+        bestQueue = queueIndex;
+      }
+    }
+
+    if (best == nullptr) {
+      return tl::nullopt;
+    }
+    return {{best->pid(), bestQueue}};
+  }
+
+private:
+  CfsStrategy() : StrategyBase() {}
+
+  friend class StrategyBase<CfsStrategy>;
+
+  /**
+   *  @brief Помещает процесс в очередь его приоритета с сохранением ее
+   *  порядка.
+   *
+   *  Позиция процесса находится двоичным поиском после процессов с тем же
+   *  значением таймера. Порядок очереди проверяется при загрузке задания
+   *  (см. validateState()).
+   *
+   *  @param state Дескриптор состояния процессов.
+   *  @param pid Идентификатор процесса.
+   *
+   *  @return Новое состояние процессов.
+   */
+  ProcessesState pushToRunQueue(ProcessesState state,
+                                int32_t pid) const {
+    const auto &process = state.processes[*state.indexOf(pid)];
+    auto queueIndex = process.priority();
+
+    auto newState = pushToQueue(std::move(state), queueIndex, pid);
+    // Порядок процессов внутри очереди не входит в индекс состояния, поэтому
+    // очередь можно переупорядочить напрямую
+    auto &queue = newState.queues[queueIndex];
+    queue.pop_back();
+
+    auto byTimer = [&newState](int32_t left, int32_t right) {
+      return newState.processes[*newState.indexOf(left)].timer() <
+             newState.processes[*newState.indexOf(right)].timer();
+    };
+
+    queue.insert(std::upper_bound(queue.begin(), queue.end(), pid, byTimer),
+                 pid);
+    return newState;
+  }
+
+protected:
+  ProcessesState processRequest(const CreateProcessReq &request,
+                                ProcessesState state) const override {
+    auto newState = std::move(state);
+    auto process = request.toProcess(newState.config);
+
+    if (getIndexByPid(newState, process.pid())) {
+      return newState;
+    }
+    auto parentIndex = getIndexByPid(newState, process.ppid());
+    if (process.ppid() != -1) {
+      if (!parentIndex.has_value()) {
+        return newState;
+      }
+      if (const auto &parent = newState.processes.at(*parentIndex);
+          parent.state() != ProcState::EXECUTING) {
+        return newState;
+      }
+    }
+
+    newState = addProcess(std::move(newState), process);
+    newState = pushToRunQueue(std::move(newState), process.pid());
+
+    auto current = getCurrent(newState);
+    auto next = schedule(newState);
+    if (!current.has_value() && next.has_value()) {
+      auto [pid, queue] = next.value();
+      newState = popFromQueue(std::move(newState), queue);
+      newState = switchTo(std::move(newState), pid);
+    }
+    return newState;
+  }
+
+  ProcessesState processRequest(const TerminateProcessReq &request,
+                                ProcessesState state) const override {
+    auto newState = std::move(state);
+
+    if (!getIndexByPid(newState, request.pid())) {
+      return newState;
+    }
+
+    newState = terminateProcess(std::move(newState), request.pid());
+
+    auto current = getCurrent(newState);
+    auto next = schedule(newState);
+    if (!current.has_value() && next.has_value()) {
+      auto [pid, queue] = next.value();
+      newState = popFromQueue(std::move(newState), queue);
+      newState = switchTo(std::move(newState), pid);
+    }
+    return newState;
+  }
+
+  ProcessesState processRequest(const InitIO &request,
+                                ProcessesState state) const override {
+    auto newState = std::move(state);
+    auto processIndex = getIndexByPid(newState, request.pid());
+
+    if (!processIndex) {
+      return newState;
+    }
+    if (const auto &process = newState.processes.at(*processIndex);
+        process.state() != ProcState::EXECUTING) {
+      return newState;
+    }
+
+    newState = changeProcessState(
+        std::move(newState), request.pid(), ProcState::WAITING);
+
+    auto next = schedule(newState);
+    if (next.has_value()) {
+      auto [pid, queue] = next.value();
+      newState = popFromQueue(std::move(newState), queue);
+      newState = switchTo(std::move(newState), pid);
+    }
+    return newState;
+  }
+
+  ProcessesState processRequest(const TerminateIO &request,
+                                ProcessesState state) const override {
+    auto newState = std::move(state);
+    auto processIndex = getIndexByPid(newState, request.pid());
+
+    if (!processIndex) {
+      return newState;
+    }
+    if (const auto &process = newState.processes.at(*processIndex);
+        process.state() != ProcState::WAITING) {
+      return newState;
+    }
+
+    newState = pushToRunQueue(std::move(newState), request.pid());
+    newState = changeProcessState(
+        std::move(newState), request.pid(), ProcState::ACTIVE);
+
+    auto current = getCurrent(newState);
+    auto next = schedule(newState);
+    if (!current.has_value() && next.has_value()) {
+      auto [pid, queue] = next.value();
+      newState = popFromQueue(std::move(newState), queue);
+      newState = switchTo(std::move(newState), pid);
+    }
+    return newState;
+  }
+
+  ProcessesState processRequest(const TransferControl &request,
+                                ProcessesState state) const override {
+    auto newState = std::move(state);
+    auto processIndex = getIndexByPid(newState, request.pid());
+
+    if (!processIndex) {
+      return newState;
+    }
+    if (const auto &process = newState.processes.at(*processIndex);
+        process.state() != ProcState::EXECUTING) {
+      return newState;
+    }
+
+    newState = pushToRunQueue(std::move(newState), request.pid());
+
+    auto next = schedule(newState);
+    if (next.has_value()) {
+      auto [pid, queue] = next.value();
+      newState = popFromQueue(std::move(newState), queue);
+      newState = switchTo(std::move(newState), pid);
+    }
+    return newState;
+  }
+
+  ProcessesState processRequest(const TimeQuantumExpired &,
+                                ProcessesState state) const override {
+    auto newState = std::move(state);
+    if (auto current = getCurrent(newState); current.has_value()) {
+      auto pid = current->pid();
+      newState = pushToRunQueue(std::move(newState), pid);
+    }
+    auto next = schedule(newState);
+    if (next.has_value()) {
+      auto [pid, queue] = next.value();
+      newState = popFromQueue(std::move(newState), queue);
+      newState = switchTo(std::move(newState), pid);
+    }
+    return newState;
+  }
+};
+} // namespace ProcessesManagement
@@ -17,7 +17,7 @@ namespace ProcessesManagement {
 /**
  *  @brief Стратегия "FCFS".
  */
-class FcfsStrategy final : public AbstractStrategy {
+class FcfsStrategy final : public StrategyBase<FcfsStrategy> {
 public:
   StrategyType type() const override { return StrategyType::FCFS; }
 
@@ -29,14 +29,12 @@ public:
 
 protected:
   tl::optional<std::pair<int32_t, size_t>>
-  schedule(const ProcessesState &state) const override {
-    auto [processes, queues] = state;
-
-    if (!queues[0].empty()) {
-      auto pid = queues[0].front();
+  schedule(StateView state) const override {
+    if (!state.queue(0).empty()) {
+      auto pid = state.queue(0).front();
       return {{pid, 0}};
-    } else if (!queues[1].empty()) {
-      auto pid = queues[1].front();
+    } else if (!state.queue(1).empty()) {
+      auto pid = state.queue(1).front();
       return {{pid, 1}};
     } else {
       return tl::nullopt;
@@ -44,13 +42,15 @@ protected:
   }
 
 private:
-  FcfsStrategy() : AbstractStrategy() {}
+  FcfsStrategy() : StrategyBase() {}
+
+  friend class StrategyBase<FcfsStrategy>;
 
 protected:
   ProcessesState processRequest(const CreateProcessReq &request,
-                                const ProcessesState &state) const override {
-    auto newState = state;
-    auto process = request.toProcess();
+                                ProcessesState state) const override {
+    auto newState = std::move(state);
+    auto process = request.toProcess(newState.config);
 
     if (getIndexByPid(newState, process.pid())) {
       return newState;
@@ -60,101 +60,103 @@ protected:
       if (!parentIndex.has_value()) {
         return newState;
       }
-      if (auto parent = newState.processes.at(*parentIndex);
+      if (const auto &parent = newState.processes.at(*parentIndex);
           parent.state() != ProcState::EXECUTING) {
         return newState;
       }
     }
 
-    newState = addProcess(newState, process);
-    newState = pushToQueue(newState, 1, process.pid());
+    newState = addProcess(std::move(newState), process);
+    newState = pushToQueue(std::move(newState), 1, process.pid());
 
     auto current = getCurrent(newState);
     auto next = schedule(newState);
     if (!current.has_value() && next.has_value()) {
       auto [pid, queue] = next.value();
-      newState = popFromQueue(newState, queue);
-      newState = switchTo(newState, pid);
+      newState = popFromQueue(std::move(newState), queue);
+      newState = switchTo(std::move(newState), pid);
     }
     return newState;
   }
 
   ProcessesState processRequest(const TerminateProcessReq &request,
-                                const ProcessesState &state) const override {
-    auto newState = state;
+                                ProcessesState state) const override {
+    auto newState = std::move(state);
 
     if (!getIndexByPid(newState, request.pid())) {
       return newState;
     }
 
-    newState = terminateProcess(newState, request.pid());
+    newState = terminateProcess(std::move(newState), request.pid());
 
     auto current = getCurrent(newState);
     auto next = schedule(newState);
     if (!current.has_value() && next.has_value()) {
       auto [pid, queue] = next.value();
-      newState = popFromQueue(newState, queue);
-      newState = switchTo(newState, pid);
+      newState = popFromQueue(std::move(newState), queue);
+      newState = switchTo(std::move(newState), pid);
     }
     return newState;
   }
   ProcessesState processRequest(const InitIO &request,
-                                const ProcessesState &state) const override {
-    auto newState = state;
+                                ProcessesState state) const override {
+    auto newState = std::move(state);
     auto processIndex = getIndexByPid(newState, request.pid());
 
     if (!processIndex) {
       return newState;
     }
-    if (auto process = newState.processes.at(*processIndex);
+    if (const auto &process = newState.processes.at(*processIndex);
         process.state() != ProcState::EXECUTING) {
       return newState;
     }
 
-    newState = changeProcessState(newState, request.pid(), ProcState::WAITING);
+    newState = changeProcessState(
+        std::move(newState), request.pid(), ProcState::WAITING);
 
     auto next = schedule(newState);
     if (next.has_value()) {
       auto [pid, queue] = next.value();
-      newState = popFromQueue(newState, queue);
-      newState = switchTo(newState, pid);
+      newState = popFromQueue(std::move(newState), queue);
+      newState = switchTo(std::move(newState), pid);
     }
     return newState;
   }
   ProcessesState processRequest(const TerminateIO &request,
-                                const ProcessesState &state) const override {
-    auto newState = state;
+                                ProcessesState state) const override {
+    auto newState = std::move(state);
     auto processIndex = getIndexByPid(newState, request.pid());
 
     if (!processIndex) {
       return newState;
     }
-    if (auto process = newState.processes.at(*processIndex);
+    if (const auto &process = newState.processes.at(*processIndex);
         process.state() != ProcState::WAITING) {
       return newState;
     }
 
-    newState = pushToQueue(newState, 0, request.pid());
-    newState = changeProcessState(newState, request.pid(), ProcState::ACTIVE);
+    newState = pushToQueue(std::move(newState), 0, request.pid());
+    newState = changeProcessState(
+        std::move(newState), request.pid(), ProcState::ACTIVE);
 
     auto current = getCurrent(newState);
     auto next = schedule(newState);
     if (!current.has_value() && next.has_value()) {
       auto [pid, queue] = next.value();
-      newState = popFromQueue(newState, queue);
-      newState = switchTo(newState, pid);
+      newState = popFromQueue(std::move(newState), queue);
+      newState = switchTo(std::move(newState), pid);
     }
     return newState;
   }
   ProcessesState processRequest(const TransferControl &request,
-                                const ProcessesState &state) const override {
-    auto newState = state;
+                                ProcessesState state) const override {
+    auto newState = std::move(state);
     auto processIndex = getIndexByPid(newState, request.pid());
 
     if (!processIndex) {
       return newState;
     }
-    if (auto process = newState.processes.at(*processIndex);
+    if (const auto &process = newState.processes.at(*processIndex);
         process.state() != ProcState::EXECUTING) {
       return newState;
     }
@@ -169,18 +171,18 @@ protected:
       return newState;
     }
 
-    newState = pushToQueue(newState, 0, request.pid());
+    newState = pushToQueue(std::move(newState), 0, request.pid());
 
     auto next = schedule(newState);
     if (next.has_value()) {
       auto [pid, queue] = next.value();
-      newState = popFromQueue(newState, queue);
-      newState = switchTo(newState, pid);
+      newState = popFromQueue(std::move(newState), queue);
+      newState = switchTo(std::move(newState), pid);
     }
     return newState;
   }
   ProcessesState processRequest(const TimeQuantumExpired &,
-                                const ProcessesState &state) const override {
+                                ProcessesState state) const override {
     return state;
   }
 };
@@ -16,7 +16,7 @@ namespace ProcessesManagement {
 /**
  *  @brief Стратегия "Linux O(1)".
  */
-class LinuxO1Strategy final : public AbstractStrategy {
+class LinuxO1Strategy final : public StrategyBase<LinuxO1Strategy> {
 public:
   StrategyType type() const override { return StrategyType::LINUXO1; }
 
@@ -28,31 +28,34 @@ public:
 
 protected:
   tl::optional<std::pair<int32_t, size_t>>
-  schedule(const ProcessesState &state) const override {
-    auto [processes, queues] = state;
-
-    if (queues[0].empty()) {
+  schedule(StateView state) const override {
+    if (state.queue(0).empty()) {
       return tl::nullopt;
     } else {
-      auto pid = queues[0].front();
+      auto pid = state.queue(0).front();
       return {{pid, 0}};
     }
   }
 
 private:
-  LinuxO1Strategy() : AbstractStrategy() {}
+  LinuxO1Strategy() : StrategyBase() {}
+
+  friend class StrategyBase<LinuxO1Strategy>;
 
-  ProcessesState exchangeQueues(const ProcessesState &state) const {
+  ProcessesState exchangeQueues(ProcessesState state) const {
     if (state.queues[1].empty() || !state.queues[0].empty()) {
       return state;
     }
 
-    auto newState = state;
-    auto pids = newState.queues[1];
+    // Очередь истекших процессов становится очередью активных целиком, как
+    // при обмене указателей на массивы приоритетов в ядре
+    auto newState = std::move(state);
+    newState.swapQueues(0, 1);
 
-    for (auto pid : pids) {
-      newState = popFromQueue(newState, 1);
-      newState = pushToQueue(newState, 0, pid);
+    for (auto pid : newState.queues[0]) {
+      auto index = *newState.indexOf(pid);
+      const auto &process = newState.processes[index];
+      newState.setProcess(index, process.priority(0, newState.config));
     }
 
     return newState;
@@ -60,9 +63,9 @@ private:
 
 protected:
   ProcessesState processRequest(const CreateProcessReq &request,
-                                const ProcessesState &state) const override {
-    auto newState = state;
-    auto process = request.toProcess();
+                                ProcessesState state) const override {
+    auto newState = std::move(state);
+    auto process = request.toProcess(newState.config);
 
     if (getIndexByPid(newState, process.pid())) {
       return newState;
@@ -72,140 +75,142 @@ protected:
       if (!parentIndex.has_value()) {
         return newState;
       }
-      if (auto parent = newState.processes.at(*parentIndex);
+      if (const auto &parent = newState.processes.at(*parentIndex);
           parent.state() != ProcState::EXECUTING) {
         return newState;
       }
     }
 
-    newState = addProcess(newState, process);
-    newState = pushToQueue(newState, 0, process.pid());
+    newState = addProcess(std::move(newState), process);
+    newState = pushToQueue(std::move(newState), 0, process.pid());
 
     auto current = getCurrent(newState);
     auto next = schedule(newState);
     if (!current.has_value() && next.has_value()) {
       auto [pid, queue] = next.value();
-      newState = popFromQueue(newState, queue);
-      newState = switchTo(newState, pid);
+      newState = popFromQueue(std::move(newState), queue);
+      newState = switchTo(std::move(newState), pid);
     }
     return newState;
   }
 
   ProcessesState processRequest(const TerminateProcessReq &request,
-                                const ProcessesState &state) const override {
-    auto newState = state;
+                                ProcessesState state) const override {
+    auto newState = std::move(state);
 
     if (!getIndexByPid(newState, request.pid())) {
       return newState;
     }
 
-    newState = terminateProcess(newState, request.pid());
+    newState = terminateProcess(std::move(newState), request.pid());
 
     auto current = getCurrent(newState);
     if (!current.has_value()) {
-      newState = exchangeQueues(newState);
+      newState = exchangeQueues(std::move(newState));
       auto next = schedule(newState);
       if (next.has_value()) {
         auto [pid, queue] = next.value();
-        newState = popFromQueue(newState, queue);
-        newState = switchTo(newState, pid);
+        newState = popFromQueue(std::move(newState), queue);
+        newState = switchTo(std::move(newState), pid);
       }
     }
     return newState;
   }
 
   ProcessesState processRequest(const InitIO &request,
-                                const ProcessesState &state) const override {
-    auto newState = state;
+                                ProcessesState state) const override {
+    auto newState = std::move(state);
     auto processIndex = getIndexByPid(newState, request.pid());
 
     if (!processIndex) {
       return newState;
     }
-    if (auto process = newState.processes.at(*processIndex);
+    if (const auto &process = newState.processes.at(*processIndex);
         process.state() != ProcState::EXECUTING) {
       return newState;
     }
 
-    newState = changeProcessState(newState, request.pid(), ProcState::WAITING);
+    newState = changeProcessState(
+        std::move(newState), request.pid(), ProcState::WAITING);
 
-    newState = exchangeQueues(newState);
+    newState = exchangeQueues(std::move(newState));
     auto next = schedule(newState);
     if (next.has_value()) {
       auto [pid, queue] = next.value();
-      newState = popFromQueue(newState, queue);
-      newState = switchTo(newState, pid);
+      newState = popFromQueue(std::move(newState), queue);
+      newState = switchTo(std::move(newState), pid);
     }
     return newState;
   }
 
   ProcessesState processRequest(const TerminateIO &request,
-                                const ProcessesState &state) const override {
-    auto newState = state;
+                                ProcessesState state) const override {
+    auto newState = std::move(state);
     auto processIndex = getIndexByPid(newState, request.pid());
 
     if (!processIndex) {
       return newState;
     }
-    if (auto process = newState.processes.at(*processIndex);
+    if (const auto &process = newState.processes.at(*processIndex);
         process.state() != ProcState::WAITING) {
       return newState;
     }
 
-    newState = pushToQueue(newState, 0, request.pid());
-    newState = changeProcessState(newState, request.pid(), ProcState::ACTIVE);
+    newState = pushToQueue(std::move(newState), 0, request.pid());
+    newState = changeProcessState(
+        std::move(newState), request.pid(), ProcState::ACTIVE);
 
     auto current = getCurrent(newState);
     if (!current.has_value()) {
-      newState = exchangeQueues(newState);
+      newState = exchangeQueues(std::move(newState));
       auto next = schedule(newState);
       if (next.has_value()) {
         auto [pid, queue] = next.value();
-        newState = popFromQueue(newState, queue);
-        newState = switchTo(newState, pid);
+        newState = popFromQueue(std::move(newState), queue);
+        newState = switchTo(std::move(newState), pid);
       }
     }
     return newState;
   }
 
   ProcessesState processRequest(const TransferControl &request,
-                                const ProcessesState &state) const override {
-    auto newState = state;
+                                ProcessesState state) const override {
+    auto newState = std::move(state);
     auto processIndex = getIndexByPid(newState, request.pid());
 
     if (!processIndex) {
       return newState;
     }
-    if (auto process = newState.processes.at(*processIndex);
+    if (const auto &process = newState.processes.at(*processIndex);
         process.state() != ProcState::EXECUTING) {
       return newState;
     }
 
-    newState = pushToQueue(newState, 0, request.pid());
+    newState = pushToQueue(std::move(newState), 0, request.pid());
 
     auto next = schedule(newState);
     if (next.has_value()) {
       auto [pid, queue] = next.value();
-      newState = popFromQueue(newState, queue);
-      newState = switchTo(newState, pid);
+      newState = popFromQueue(std::move(newState), queue);
+      newState = switchTo(std::move(newState), pid);
     }
     return newState;
   }
 
   ProcessesState processRequest(const TimeQuantumExpired &,
-                                const ProcessesState &state) const override {
-    auto newState = state;
-    auto current = getCurrent(newState);
-    if (current.has_value()) {
-      newState = pushToQueue(newState, 1, current->pid());
+                                ProcessesState state) const override {
+    auto newState = std::move(state);
+    if (auto current = getCurrent(newState); current.has_value()) {
+      auto pid = current->pid();
+      newState = pushToQueue(std::move(newState), 1, pid);
     }
 
-    newState = exchangeQueues(newState);
+    newState = exchangeQueues(std::move(newState));
     auto next = schedule(newState);
     if (next.has_value()) {
       auto [pid, queue] = next.value();
-      newState = popFromQueue(newState, queue);
-      newState = switchTo(newState, pid);
+      newState = popFromQueue(std::move(newState), queue);
+      newState = switchTo(std::move(newState), pid);
     }
     return newState;
   }
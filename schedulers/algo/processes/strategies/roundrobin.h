@@ -16,7 +16,7 @@ namespace ProcessesManagement {
 /**
  *  @brief Стратегия "RoundRobin".
  */
-class RoundRobinStrategy final : public AbstractStrategy {
+class RoundRobinStrategy final : public StrategyBase<RoundRobinStrategy> {
 public:
   StrategyType type() const override { return StrategyType::ROUNDROBIN; }
 
@@ -28,25 +28,25 @@ public:
 
 protected:
   tl::optional<std::pair<int32_t, size_t>>
-  schedule(const ProcessesState &state) const override {
-    auto [processes, queues] = state;
-
-    if (queues[0].empty()) {
+  schedule(StateView state) const override {
+    if (state.queue(0).empty()) {
       return tl::nullopt;
     } else {
-      auto pid = queues[0].front();
+      auto pid = state.queue(0).front();
       return {{pid, 0}};
     }
   }
 
 private:
-  RoundRobinStrategy() : AbstractStrategy() {}
+  RoundRobinStrategy() : StrategyBase() {}
+
+  friend class StrategyBase<RoundRobinStrategy>;
 
 protected:
   ProcessesState processRequest(const CreateProcessReq &request,
-                                const ProcessesState &state) const override {
-    auto newState = state;
-    auto process = request.toProcess();
+                                ProcessesState state) const override {
+    auto newState = std::move(state);
+    auto process = request.toProcess(newState.config);
 
     if (getIndexByPid(newState, process.pid())) {
       return newState;
@@ -56,126 +56,128 @@ protected:
       if (!parentIndex.has_value()) {
         return newState;
       }
-      if (auto parent = newState.processes.at(*parentIndex);
+      if (const auto &parent = newState.processes.at(*parentIndex);
           parent.state() != ProcState::EXECUTING) {
         return newState;
       }
     }
 
-    newState = addProcess(newState, process);
-    newState = pushToQueue(newState, 0, process.pid());
+    newState = addProcess(std::move(newState), process);
+    newState = pushToQueue(std::move(newState), 0, process.pid());
 
     auto current = getCurrent(newState);
     auto next = schedule(newState);
     if (!current.has_value() && next.has_value()) {
       auto [pid, queue] = next.value();
-      newState = popFromQueue(newState, queue);
-      newState = switchTo(newState, pid);
+      newState = popFromQueue(std::move(newState), queue);
+      newState = switchTo(std::move(newState), pid);
     }
     return newState;
   }
   ProcessesState processRequest(const TerminateProcessReq &request,
-                                const ProcessesState &state) const override {
-    auto newState = state;
+                                ProcessesState state) const override {
+    auto newState = std::move(state);
 
     if (!getIndexByPid(newState, request.pid())) {
       return newState;
     }
 
-    newState = terminateProcess(newState, request.pid());
+    newState = terminateProcess(std::move(newState), request.pid());
 
     auto current = getCurrent(newState);
     auto next = schedule(newState);
     if (!current.has_value() && next.has_value()) {
       auto [pid, queue] = next.value();
-      newState = popFromQueue(newState, queue);
-      newState = switchTo(newState, pid);
+      newState = popFromQueue(std::move(newState), queue);
+      newState = switchTo(std::move(newState), pid);
     }
     return newState;
   }
   ProcessesState processRequest(const InitIO &request,
-                                const ProcessesState &state) const override {
-    auto newState = state;
+                                ProcessesState state) const override {
+    auto newState = std::move(state);
     auto processIndex = getIndexByPid(newState, request.pid());
 
     if (!processIndex) {
       return newState;
     }
-    if (auto process = newState.processes.at(*processIndex);
+    if (const auto &process = newState.processes.at(*processIndex);
         process.state() != ProcState::EXECUTING) {
       return newState;
     }
 
-    newState = changeProcessState(newState, request.pid(), ProcState::WAITING);
+    newState = changeProcessState(
+        std::move(newState), request.pid(), ProcState::WAITING);
 
     auto next = schedule(newState);
     if (next.has_value()) {
       auto [pid, queue] = next.value();
-      newState = popFromQueue(newState, queue);
-      newState = switchTo(newState, pid);
+      newState = popFromQueue(std::move(newState), queue);
+      newState = switchTo(std::move(newState), pid);
     }
     return newState;
   }
   ProcessesState processRequest(const TerminateIO &request,
-                                const ProcessesState &state) const override {
-    auto newState = state;
+                                ProcessesState state) const override {
+    auto newState = std::move(state);
     auto processIndex = getIndexByPid(newState, request.pid());
 
     if (!processIndex) {
       return newState;
     }
-    if (auto process = newState.processes.at(*processIndex);
+    if (const auto &process = newState.processes.at(*processIndex);
         process.state() != ProcState::WAITING) {
       return newState;
     }
 
-    newState = pushToQueue(newState, 0, request.pid());
-    newState = changeProcessState(newState, request.pid(), ProcState::ACTIVE);
+    newState = pushToQueue(std::move(newState), 0, request.pid());
+    newState = changeProcessState(
+        std::move(newState), request.pid(), ProcState::ACTIVE);
 
     auto current = getCurrent(newState);
     auto next = schedule(newState);
     if (!current.has_value() && next.has_value()) {
       auto [pid, queue] = next.value();
-      newState = popFromQueue(newState, queue);
-      newState = switchTo(newState, pid);
+      newState = popFromQueue(std::move(newState), queue);
+      newState = switchTo(std::move(newState), pid);
     }
     return newState;
   }
   ProcessesState processRequest(const TransferControl &request,
-                                const ProcessesState &state) const override {
-    auto newState = state;
+                                ProcessesState state) const override {
+    auto newState = std::move(state);
     auto processIndex = getIndexByPid(newState, request.pid());
 
     if (!processIndex) {
       return newState;
     }
-    if (auto process = newState.processes.at(*processIndex);
+    if (const auto &process = newState.processes.at(*processIndex);
         process.state() != ProcState::EXECUTING) {
       return newState;
     }
 
-    newState = pushToQueue(newState, 0, request.pid());
+    newState = pushToQueue(std::move(newState), 0, request.pid());
 
     auto next = schedule(newState);
     if (next.has_value()) {
       auto [pid, queue] = next.value();
-      newState = popFromQueue(newState, queue);
-      newState = switchTo(newState, pid);
+      newState = popFromQueue(std::move(newState), queue);
+      newState = switchTo(std::move(newState), pid);
     }
     return newState;
   }
   ProcessesState processRequest(const TimeQuantumExpired &,
-                                const ProcessesState &state) const override {
-    auto newState = state;
-    auto current = getCurrent(newState);
-    if (current.has_value()) {
-      newState = pushToQueue(newState, 0, current->pid());
+                                ProcessesState state) const override {
+    auto newState = std::move(state);
+    if (auto current = getCurrent(newState); current.has_value()) {
+      auto pid = current->pid();
+      newState = pushToQueue(std::move(newState), 0, pid);
     }
     auto next = schedule(newState);
     if (next.has_value()) {
       auto [pid, queue] = next.value();
-      newState = popFromQueue(newState, queue);
-      newState = switchTo(newState, pid);
+      newState = popFromQueue(std::move(newState), queue);
+      newState = switchTo(std::move(newState), pid);
     }
     return newState;
   }
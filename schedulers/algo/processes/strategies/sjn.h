@@ -1,8 +1,6 @@
 #pragma once
 
 #include <algorithm>
-#include <deque>
-#include <map>
 #include <cstddef>
 #include <cstdint>
 #include <memory>
@@ -21,7 +19,7 @@ namespace ProcessesManagement {
 /**
  *  @brief Стратегия "SJT".
  */
-class SjnStrategy : public AbstractStrategy {
+class SjnStrategy : public StrategyBase<SjnStrategy> {
 public:
   virtual StrategyType type() const override { return StrategyType::SJN; }
 
@@ -48,65 +46,107 @@ public:
     }
   }
 
+  /**
+   *  @brief Проверяет порядок процессов в очереди.
+   *
+   *  Очередь должна быть упорядочена по оценке времени выполнения, процессы,
+   *  проработавшие дольше заявленного времени, должны стоять в ее конце.
+   *
+   *  @see AbstractStrategy::validateState().
+   */
+  void validateState(StateView state) const override {
+    tl::optional<int32_t> previous;
+    bool overdue = false;
+    for (auto pid : state.queue(0)) {
+      auto process = state.process(pid);
+      if (!process.has_value()) {
+        throw TypeException("INVALID_STATE");
+      }
+      if (process->workTime() < process->timer()) {
+        overdue = true;
+        continue;
+      }
+      auto estimate = estimatedTime(*process);
+      if (overdue || (previous.has_value() && estimate < *previous)) {
+        throw TypeException("INVALID_STATE");
+      }
+      previous = estimate;
+    }
+  }
+
 protected:
+  // Стратегия SRT не меняет выбор процесса, поэтому он объявлен final и
+  // вызывается из обработчиков заявок невиртуально
   tl::optional<std::pair<int32_t, size_t>>
-  schedule(const ProcessesState &state) const override {
-    auto [processes, queues] = state;
-
-    if (!queues[0].empty()) {
-      auto pid = queues[0].front();
+  schedule(StateView state) const final {
+    if (!state.queue(0).empty()) {
+      auto pid = state.queue(0).front();
       return {{pid, 0}};
     } else {
       return tl::nullopt;
     }
   }
 
-  SjnStrategy() : AbstractStrategy() {}
-
-private:
-  virtual ProcessesState sortQueues(const ProcessesState &state) const {
-    auto [processes, queues] = state;
-
-    std::deque<int32_t> queue;
-    std::map<int32_t, Process> processesMap;
-
-    for (const auto &process : processes) {
-      processesMap[process.pid()] = process;
-    }
-
-    for (int32_t pid : queues[0]) {
-      const auto &process = processesMap.at(pid);
-      if (process.workTime() >= process.timer()) {
-        queue.push_back(process.pid());
-      }
-    }
+  SjnStrategy() : StrategyBase() {}
 
-    std::stable_sort(queue.begin(),
-                     queue.end(),
-                     [&processesMap](int32_t left, int32_t right) {
-                       auto leftTime = processesMap[left].workTime();
-                       auto rightTime = processesMap[right].workTime();
+  friend class StrategyBase<SjnStrategy>;
 
-                       return leftTime < rightTime;
-                     });
+  /**
+   *  @brief Возвращает оценку времени, по которой упорядочивается очередь.
+   *
+   *  @param process Дескриптор процесса.
+   */
+  virtual int32_t estimatedTime(const Process &process) const {
+    return process.workTime();
+  }
 
-    for (int32_t pid : queues[0]) {
-      const auto &process = processesMap.at(pid);
-      if (process.workTime() < process.timer()) {
-        queue.push_back(process.pid());
-      }
+private:
+  /**
+   *  @brief Помещает процесс в очередь с сохранением ее порядка.
+   *
+   *  Очередь упорядочена по оценке времени выполнения, процессы, проработавшие
+   *  дольше заявленного времени, стоят в конце очереди в порядке поступления.
+   *  Начало этих процессов и позиция процесса (после процессов с той же
+   *  оценкой) находятся двоичным поиском. Порядок очереди проверяется при
+   *  загрузке задания (см. validateState()).
+   *
+   *  @param state Дескриптор состояния процессов.
+   *  @param pid Идентификатор процесса.
+   *
+   *  @return Новое состояние процессов.
+   */
+  ProcessesState pushToReadyQueue(ProcessesState state,
+                                  int32_t pid) const {
+    auto newState = pushToQueue(std::move(state), 0, pid);
+    // Порядок процессов внутри очереди не входит в индекс состояния, поэтому
+    // очередь можно переупорядочить напрямую
+    auto &queue = newState.queues[0];
+    queue.pop_back();
+
+    auto process = [&newState](int32_t pid) -> const Process & {
+      return newState.processes[*newState.indexOf(pid)];
+    };
+    auto inTime = [&process](int32_t pid) {
+      return process(pid).workTime() >= process(pid).timer();
+    };
+    auto byTime = [this, &process](int32_t left, int32_t right) {
+      return estimatedTime(process(left)) < estimatedTime(process(right));
+    };
+
+    if (!inTime(pid)) {
+      queue.push_back(pid);
+      return newState;
     }
-
-    queues[0] = queue;
-
-    return {processes, queues};
+    auto tail = std::partition_point(queue.begin(), queue.end(), inTime);
+    queue.insert(std::upper_bound(queue.begin(), tail, pid, byTime), pid);
+    return newState;
   }
 
 protected:
   ProcessesState processRequest(const CreateProcessReq &request,
-                                const ProcessesState &state) const override {
-    auto newState = state;
-    auto process = request.toProcess();
+                                ProcessesState state) const override {
+    auto newState = std::move(state);
+    auto process = request.toProcess(newState.config);
 
     if (getIndexByPid(newState, process.pid())) {
       return newState;
@@ -116,125 +156,124 @@ protected:
       if (!parentIndex.has_value()) {
         return newState;
       }
-      if (auto parent = newState.processes.at(*parentIndex);
+      if (const auto &parent = newState.processes.at(*parentIndex);
           parent.state() != ProcState::EXECUTING) {
         return newState;
       }
     }
 
-    newState = addProcess(newState, process);
-    newState = pushToQueue(newState, 0, process.pid());
-    newState = sortQueues(newState);
+    newState = addProcess(std::move(newState), process);
+    newState = pushToReadyQueue(std::move(newState), process.pid());
 
     auto current = getCurrent(newState);
     auto next = schedule(newState);
     if (!current && next) {
       auto [pid, queue] = next.value();
-      newState = popFromQueue(newState, queue);
-      newState = switchTo(newState, pid);
+      newState = popFromQueue(std::move(newState), queue);
+      newState = switchTo(std::move(newState), pid);
     }
 
     return newState;
   }
 
   ProcessesState processRequest(const TerminateProcessReq &request,
-                                const ProcessesState &state) const override {
-    auto newState = state;
+                                ProcessesState state) const override {
+    auto newState = std::move(state);
 
     if (!getIndexByPid(newState, request.pid())) {
       return newState;
     }
 
-    newState = terminateProcess(newState, request.pid());
+    newState = terminateProcess(std::move(newState), request.pid());
 
     auto current = getCurrent(newState);
     auto next = schedule(newState);
     if (!current && next) {
       auto [pid, queue] = next.value();
-      newState = popFromQueue(newState, queue);
-      newState = switchTo(newState, pid);
+      newState = popFromQueue(std::move(newState), queue);
+      newState = switchTo(std::move(newState), pid);
     }
     return newState;
   }
 
   ProcessesState processRequest(const InitIO &request,
-                                const ProcessesState &state) const override {
-    auto newState = state;
+                                ProcessesState state) const override {
+    auto newState = std::move(state);
     auto processIndex = getIndexByPid(newState, request.pid());
 
     if (!processIndex) {
       return newState;
     }
-    if (auto process = newState.processes.at(*processIndex);
+    if (const auto &process = newState.processes.at(*processIndex);
         process.state() != ProcState::EXECUTING) {
       return newState;
     }
 
-    newState = changeProcessState(newState, request.pid(), ProcState::WAITING);
+    newState = changeProcessState(
+        std::move(newState), request.pid(), ProcState::WAITING);
 
     auto next = schedule(newState);
     if (next) {
       auto [pid, queue] = next.value();
-      newState = popFromQueue(newState, queue);
-      newState = switchTo(newState, pid);
+      newState = popFromQueue(std::move(newState), queue);
+      newState = switchTo(std::move(newState), pid);
     }
     return newState;
   }
 
   ProcessesState processRequest(const TerminateIO &request,
-                                const ProcessesState &state) const override {
-    auto newState = state;
+                                ProcessesState state) const override {
+    auto newState = std::move(state);
     auto processIndex = getIndexByPid(newState, request.pid());
 
     if (!processIndex) {
       return newState;
     }
-    if (auto process = newState.processes.at(*processIndex);
+    if (const auto &process = newState.processes.at(*processIndex);
         process.state() != ProcState::WAITING) {
       return newState;
     }
 
-    newState = pushToQueue(newState, 0, request.pid());
-    newState = sortQueues(newState);
-    newState = changeProcessState(newState, request.pid(), ProcState::ACTIVE);
+    newState = pushToReadyQueue(std::move(newState), request.pid());
+    newState = changeProcessState(
+        std::move(newState), request.pid(), ProcState::ACTIVE);
 
     auto current = getCurrent(newState);
     auto next = schedule(newState);
     if (!current && next) {
       auto [pid, queue] = next.value();
-      newState = popFromQueue(newState, queue);
-      newState = switchTo(newState, pid);
+      newState = popFromQueue(std::move(newState), queue);
+      newState = switchTo(std::move(newState), pid);
     }
     return newState;
   }
 
   ProcessesState processRequest(const TransferControl &request,
-                                const ProcessesState &state) const override {
-    auto newState = state;
+                                ProcessesState state) const override {
+    auto newState = std::move(state);
     auto processIndex = getIndexByPid(newState, request.pid());
 
     if (!processIndex) {
       return newState;
     }
-    if (auto process = newState.processes.at(*processIndex);
+    if (const auto &process = newState.processes.at(*processIndex);
         process.state() != ProcState::EXECUTING) {
       return newState;
     }
 
-    newState = pushToQueue(newState, 0, request.pid());
-    newState = sortQueues(newState);
+    newState = pushToReadyQueue(std::move(newState), request.pid());
 
     auto next = schedule(newState);
     if (next) {
       auto [pid, queue] = next.value();
-      newState = popFromQueue(newState, queue);
-      newState = switchTo(newState, pid);
+      newState = popFromQueue(std::move(newState), queue);
+      newState = switchTo(std::move(newState), pid);
     }
     return newState;
   }
 
   ProcessesState processRequest(const TimeQuantumExpired &,
-                                const ProcessesState &state) const override {
+                                ProcessesState state) const override {
     return state;
   }
 };
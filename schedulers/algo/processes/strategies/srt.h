@@ -1,8 +1,5 @@
 #pragma once
 
-#include <algorithm>
-#include <deque>
-#include <map>
 #include <cstdint>
 #include <memory>
 #include <sstream>
@@ -27,47 +24,12 @@ public:
     return std::shared_ptr<SrtStrategy>(new SrtStrategy());
   }
 
+protected:
+  int32_t estimatedTime(const Process &process) const override {
+    return process.workTime() - process.timer();
+  }
+
 private:
   SrtStrategy() : SjnStrategy() {}
-
-  ProcessesState sortQueues(const ProcessesState &state) const override {
-    auto [processes, queues] = state;
-
-    std::deque<int32_t> queue;
-    std::map<int32_t, Process> processesMap;
-
-    for (const auto &process : processes) {
-      processesMap[process.pid()] = process;
-    }
-
-    for (int32_t pid : queues[0]) {
-      const auto &process = processesMap.at(pid);
-      if (process.workTime() >= process.timer()) {
-        queue.push_back(process.pid());
-      }
-    }
-
-    std::stable_sort(queue.begin(),
-                     queue.end(),
-                     [&processesMap](int32_t left, int32_t right) {
-                       auto leftTime = processesMap[left].workTime() -
-                                       processesMap[left].timer();
-                       auto rightTime = processesMap[right].workTime() -
-                                        processesMap[right].timer();
-
-                       return leftTime < rightTime;
-                     });
-
-    for (int32_t pid : queues[0]) {
-      const auto &process = processesMap.at(pid);
-      if (process.workTime() < process.timer()) {
-        queue.push_back(process.pid());
-      }
-    }
-
-    queues[0] = queue;
-
-    return {processes, queues};
-  }
 };
 } // namespace ProcessesManagement
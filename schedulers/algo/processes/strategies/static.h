@@ -0,0 +1,95 @@
+#pragma once
+
+#include <memory>
+#include <utility>
+
+#include <mapbox/variant.hpp>
+
+#include "../exceptions.h"
+#include "../requests.h"
+#include "../types.h"
+#include "abstract.h"
+#include "cfs.h"
+#include "fcfs.h"
+#include "linuxo1.h"
+#include "roundrobin.h"
+#include "sjn.h"
+#include "srt.h"
+#include "unix.h"
+#include "winnt.h"
+
+namespace ProcessesManagement {
+/**
+ *  @brief Стратегия, конкретный тип которой известен на этапе компиляции.
+ *
+ *  Заявка, обработанная через dispatchRequest(), передается стратегии
+ *  сопоставлением варианта и далее StrategyBase::dispatch() без виртуальных
+ *  вызовов. Основным интерфейсом стратегий остается StrategyPtr.
+ *
+ *  Вариант используется только для сравнения способов диспетчеризации в
+ *  замерах производительности (benchmarks/processes): замеры не показали
+ *  выигрыша по сравнению с виртуальными вызовами, поэтому обработка
+ *  последовательностей заявок (AbstractStrategy::processRequests(),
+ *  Utils::ReplayCache) использует StrategyPtr.
+ */
+using StaticStrategy =
+    mapbox::util::variant<std::shared_ptr<RoundRobinStrategy>,
+                          std::shared_ptr<FcfsStrategy>,
+                          std::shared_ptr<SjnStrategy>,
+                          std::shared_ptr<SrtStrategy>,
+                          std::shared_ptr<WinNtStrategy>,
+                          std::shared_ptr<UnixStrategy>,
+                          std::shared_ptr<LinuxO1Strategy>,
+                          std::shared_ptr<CfsStrategy>>;
+
+/**
+ *  @brief Возвращает стратегию в виде StaticStrategy.
+ *
+ *  @param strategy Стратегия.
+ *
+ *  @return Стратегия, разделяющая владение с @a strategy.
+ *
+ *  @throws ProcessesManagement::TypeException Исключение возникает, если тип
+ *  стратегии неизвестен.
+ */
+inline StaticStrategy toStaticStrategy(const StrategyPtr &strategy) {
+  switch (strategy->type()) {
+  case StrategyType::ROUNDROBIN:
+    return std::static_pointer_cast<RoundRobinStrategy>(strategy);
+  case StrategyType::FCFS:
+    return std::static_pointer_cast<FcfsStrategy>(strategy);
+  case StrategyType::SJN:
+    return std::static_pointer_cast<SjnStrategy>(strategy);
+  case StrategyType::SRT:
+    return std::static_pointer_cast<SrtStrategy>(strategy);
+  case StrategyType::WINDOWS:
+    return std::static_pointer_cast<WinNtStrategy>(strategy);
+  case StrategyType::UNIX:
+    return std::static_pointer_cast<UnixStrategy>(strategy);
+  case StrategyType::LINUXO1:
+    return std::static_pointer_cast<LinuxO1Strategy>(strategy);
+  case StrategyType::CFS:
+    return std::static_pointer_cast<CfsStrategy>(strategy);
+  }
+  throw TypeException("UNKNOWN_STRATEGY");
+}
+
+/**
+ *  @brief Обрабатывает заявку любого типа без виртуальных вызовов.
+ *
+ *  Результат совпадает с результатом AbstractStrategy::processRequest().
+ *
+ *  @param strategy Стратегия.
+ *  @param request Заявка.
+ *  @param state Дескриптор состояния процессов.
+ *
+ *  @return Новое состояние процессов.
+ */
+inline ProcessesState dispatchRequest(const StaticStrategy &strategy,
+                                      const Request &request,
+                                      ProcessesState state) {
+  return strategy.match([&request, &state](const auto &concrete) {
+    return concrete->dispatch(request, std::move(state));
+  });
+}
+} // namespace ProcessesManagement
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <algorithm>
 #include <cstddef>
 #include <cstdint>
 #include <memory>
@@ -16,8 +17,14 @@
 namespace ProcessesManagement {
 /**
  *  @brief Стратегия "UNIX".
+ *
+ *  Приоритет выполняющегося процесса понижается каждые 2 такта (только для
+ *  приоритетов от 0 до 7). Понижение не откладывается до постановки процесса
+ *  в очередь: состояние после каждой заявки отображается и сравнивается с
+ *  ответом пользователя, поэтому приоритет вычисляется перед обработкой
+ *  каждой заявки за один такт (см. beforeRequest()).
  */
-class UnixStrategy final : public AbstractStrategy {
+class UnixStrategy final : public StrategyBase<UnixStrategy> {
 public:
   StrategyType type() const override { return StrategyType::UNIX; }
 
@@ -43,43 +50,78 @@ public:
     }
   }
 
-  ProcessesState processRequest(const Request &request,
-                                const ProcessesState &state) const override {
-    auto newState = state;
-    /*
-     * Каждые 2 такта уменьшать приоритет на 1 (только для приоритетов от 0 до
-     * 7)
-     */
-    auto index = getIndexByState(newState.processes, ProcState::EXECUTING);
-    if (index) {
-      auto &current = newState.processes.at(*index);
-      if (current.timer() % 2 == 0 && current.timer() > 0 &&
-          current.priority() > 0 && current.priority() < 8) {
-        current = current.priority(current.priority() - 1);
-      }
-    }
-    return AbstractStrategy::processRequest(request, newState);
-  }
-
 protected:
   tl::optional<std::pair<int32_t, size_t>>
-  schedule(const ProcessesState &state) const override {
-    auto [processes, queues] = state;
-
-    for (size_t j = 0, i = 15; j < queues.size(); ++j, --i) {
-      if (!queues[i].empty()) {
-        auto pid = queues[i].front();
-        return {{pid, i}};
-      }
+  schedule(StateView state) const override {
+    if (auto queueIndex = state.highestNonEmptyQueue(); queueIndex) {
+      auto pid = state.queue(*queueIndex).front();
+      return {{pid, *queueIndex}};
     }
     return tl::nullopt;
   }
 
 private:
-  UnixStrategy() : AbstractStrategy() {}
+  UnixStrategy() : StrategyBase() {}
+
+  friend class StrategyBase<UnixStrategy>;
+
+  /**
+   *  @brief Понижает приоритет выполняющегося процесса перед обработкой
+   *  заявки: заявка занимает один такт его выполнения.
+   *
+   *  Стоимость не зависит от количества процессов: выполняющийся процесс
+   *  находится по индексу состояния, приоритеты остальных процессов не
+   *  меняются.
+   *
+   *  @param state Дескриптор состояния процессов.
+   *
+   *  @return Новое состояние процессов.
+   */
+  ProcessesState beforeRequest(ProcessesState state) const {
+    auto newState = std::move(state);
+    auto index = getIndexByState(newState, ProcState::EXECUTING);
+    if (index) {
+      const auto &current = newState.processes.at(*index);
+      auto priority = decayedPriority(
+          current.priority(), current.timer(), current.timer() + 1);
+      if (priority != current.priority()) {
+        newState.setProcess(*index,
+                            current.priority(priority, newState.config));
+      }
+    }
+    return newState;
+  }
+
+  /**
+   *  @brief Вычисляет приоритет процесса после нескольких тактов выполнения.
+   *
+   *  Каждые 2 такта приоритет уменьшается на 1 (только для приоритетов от 0 до
+   *  7). Число понижений вычисляется сразу для всего интервала по значениям
+   *  таймера процесса, поэтому стоимость не зависит от длины интервала;
+   *  beforeRequest() вызывает метод для интервала в один такт.
+   *
+   *  @param priority Приоритет процесса в начале интервала.
+   *  @param from Значение таймера процесса в начале интервала.
+   *  @param to Значение таймера процесса в конце интервала (не включая).
+   *
+   *  @return Приоритет процесса в конце интервала.
+   */
+  static std::size_t
+  decayedPriority(std::size_t priority, int32_t from, int32_t to) {
+    if (priority == 0 || priority >= 8) {
+      return priority;
+    }
+    // Приоритет понижается на тактах с четным положительным значением таймера
+    auto first = std::max(from, 1);
+    if (to <= first) {
+      return priority;
+    }
+    auto decays = static_cast<std::size_t>((to - 1) / 2 - (first - 1) / 2);
+    return decays < priority ? priority - decays : 0;
+  }
 
-  ProcessesState resetTimer(const ProcessesState &state, int32_t pid) const {
-    auto newState = state;
+  ProcessesState resetTimer(ProcessesState state, int32_t pid) const {
+    auto newState = std::move(state);
     auto index = getIndexByPid(newState, pid);
     if (index) {
       auto &process = newState.processes.at(*index);
@@ -91,9 +133,9 @@ private:
 
 protected:
   ProcessesState processRequest(const CreateProcessReq &request,
-                                const ProcessesState &state) const override {
-    auto newState = state;
-    auto process = request.toProcess();
+                                ProcessesState state) const override {
+    auto newState = std::move(state);
+    auto process = request.toProcess(newState.config);
 
     if (getIndexByPid(newState, process.pid())) {
       return newState;
@@ -103,73 +145,75 @@ protected:
       if (!parentIndex.has_value()) {
         return newState;
       }
-      if (auto parent = newState.processes.at(*parentIndex);
+      if (const auto &parent = newState.processes.at(*parentIndex);
           parent.state() != ProcState::EXECUTING) {
         return newState;
       }
     }
 
-    newState = addProcess(newState, process);
-    newState = pushToQueue(newState, process.priority(), process.pid());
+    newState = addProcess(std::move(newState), process);
+    newState = pushToQueue(
+        std::move(newState), process.priority(), process.pid());
 
     auto current = getCurrent(newState);
     auto next = schedule(newState);
     if (!current && next) {
       auto [pid, queue] = next.value();
-      newState = popFromQueue(newState, queue);
-      newState = switchTo(newState, pid);
+      newState = popFromQueue(std::move(newState), queue);
+      newState = switchTo(std::move(newState), pid);
     }
     return newState;
   }
 
   ProcessesState processRequest(const TerminateProcessReq &request,
-                                const ProcessesState &state) const override {
-    auto newState = state;
+                                ProcessesState state) const override {
+    auto newState = std::move(state);
 
     if (!getIndexByPid(newState, request.pid())) {
       return newState;
     }
 
-    newState = terminateProcess(newState, request.pid());
+    newState = terminateProcess(std::move(newState), request.pid());
 
     auto current = getCurrent(newState);
     auto next = schedule(newState);
     if (!current && next) {
       auto [pid, queue] = next.value();
-      newState = popFromQueue(newState, queue);
-      newState = switchTo(newState, pid);
+      newState = popFromQueue(std::move(newState), queue);
+      newState = switchTo(std::move(newState), pid);
     }
     return newState;
   }
 
   ProcessesState processRequest(const InitIO &request,
-                                const ProcessesState &state) const override {
-    auto newState = state;
+                                ProcessesState state) const override {
+    auto newState = std::move(state);
     auto processIndex = getIndexByPid(newState, request.pid());
 
     if (!processIndex) {
       return newState;
     }
-    if (auto process = newState.processes.at(*processIndex);
+    if (const auto &process = newState.processes.at(*processIndex);
         process.state() != ProcState::EXECUTING) {
       return newState;
     }
 
-    newState = changeProcessState(newState, request.pid(), ProcState::WAITING);
-    newState = resetTimer(newState, request.pid());
+    newState = changeProcessState(
+        std::move(newState), request.pid(), ProcState::WAITING);
+    newState = resetTimer(std::move(newState), request.pid());
 
     auto next = schedule(newState);
     if (next) {
       auto [pid, queue] = next.value();
-      newState = popFromQueue(newState, queue);
-      newState = switchTo(newState, pid);
+      newState = popFromQueue(std::move(newState), queue);
+      newState = switchTo(std::move(newState), pid);
     }
     return newState;
   }
 
   ProcessesState processRequest(const TerminateIO &request,
-                                const ProcessesState &state) const override {
-    auto newState = state;
+                                ProcessesState state) const override {
+    auto newState = std::move(state);
     auto processIndex = getIndexByPid(newState, request.pid());
 
     if (!processIndex) {
@@ -182,22 +226,23 @@ protected:
 
     auto newPriority =
         process.priority() < 7 ? process.priority() + 1 : process.priority();
-    newState = pushToQueue(newState, newPriority, request.pid());
-    newState = changeProcessState(newState, request.pid(), ProcState::ACTIVE);
+    newState = pushToQueue(std::move(newState), newPriority, request.pid());
+    newState = changeProcessState(
+        std::move(newState), request.pid(), ProcState::ACTIVE);
 
     auto current = getCurrent(newState);
     auto next = schedule(newState);
     if (!current && next) {
       auto [pid, queue] = next.value();
-      newState = popFromQueue(newState, queue);
-      newState = switchTo(newState, pid);
+      newState = popFromQueue(std::move(newState), queue);
+      newState = switchTo(std::move(newState), pid);
     }
     return newState;
   }
 
   ProcessesState processRequest(const TransferControl &request,
-                                const ProcessesState &state) const override {
-    auto newState = state;
+                                ProcessesState state) const override {
+    auto newState = std::move(state);
     auto processIndex = getIndexByPid(newState, request.pid());
 
     if (!processIndex) {
@@ -208,29 +253,31 @@ protected:
       return newState;
     }
 
-    newState = pushToQueue(newState, process.priority(), request.pid());
+    newState = pushToQueue(
+        std::move(newState), process.priority(), request.pid());
 
     auto next = schedule(newState);
     if (next) {
       auto [pid, queue] = next.value();
-      newState = popFromQueue(newState, queue);
-      newState = switchTo(newState, pid);
+      newState = popFromQueue(std::move(newState), queue);
+      newState = switchTo(std::move(newState), pid);
     }
     return newState;
   }
 
   ProcessesState processRequest(const TimeQuantumExpired &,
-                                const ProcessesState &state) const override {
-    auto newState = state;
-    auto current = getCurrent(newState);
-    if (current) {
-      newState = pushToQueue(newState, current->priority(), current->pid());
+                                ProcessesState state) const override {
+    auto newState = std::move(state);
+    if (auto current = getCurrent(newState); current) {
+      auto priority = current->priority();
+      auto pid = current->pid();
+      newState = pushToQueue(std::move(newState), priority, pid);
     }
     auto next = schedule(newState);
     if (next) {
       auto [pid, queue] = next.value();
-      newState = popFromQueue(newState, queue);
-      newState = switchTo(newState, pid);
+      newState = popFromQueue(std::move(newState), queue);
+      newState = switchTo(std::move(newState), pid);
     }
     return newState;
   }
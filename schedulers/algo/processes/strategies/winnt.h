@@ -18,7 +18,7 @@ namespace ProcessesManagement {
 /**
  *  @brief Стратегия "WinNT".
  */
-class WinNtStrategy final : public AbstractStrategy {
+class WinNtStrategy final : public StrategyBase<WinNtStrategy> {
 public:
   StrategyType type() const override { return StrategyType::WINDOWS; }
 
@@ -52,26 +52,24 @@ public:
 
 protected:
   tl::optional<std::pair<int32_t, size_t>>
-  schedule(const ProcessesState &state) const override {
-    auto [processes, queues] = state;
-
-    for (size_t j = 0, i = 15; j < queues.size(); ++j, --i) {
-      if (!queues[i].empty()) {
-        auto pid = queues[i].front();
-        return {{pid, i}};
-      }
+  schedule(StateView state) const override {
+    if (auto queueIndex = state.highestNonEmptyQueue(); queueIndex) {
+      auto pid = state.queue(*queueIndex).front();
+      return {{pid, *queueIndex}};
     }
     return tl::nullopt;
   }
 
 private:
-  WinNtStrategy() : AbstractStrategy() {}
+  WinNtStrategy() : StrategyBase() {}
+
+  friend class StrategyBase<WinNtStrategy>;
 
 protected:
   ProcessesState processRequest(const CreateProcessReq &request,
-                                const ProcessesState &state) const override {
-    auto newState = state;
-    auto process = request.toProcess();
+                                ProcessesState state) const override {
+    auto newState = std::move(state);
+    auto process = request.toProcess(newState.config);
 
     if (getIndexByPid(newState, process.pid())) {
       return newState;
@@ -81,14 +79,15 @@ protected:
       if (!parentIndex.has_value()) {
         return newState;
       }
-      if (auto parent = newState.processes.at(*parentIndex);
+      if (const auto &parent = newState.processes.at(*parentIndex);
           parent.state() != ProcState::EXECUTING) {
         return newState;
       }
     }
 
-    newState = addProcess(newState, process);
-    newState = pushToQueue(newState, process.basePriority(), process.pid());
+    newState = addProcess(std::move(newState), process);
+    newState = pushToQueue(
+        std::move(newState), process.basePriority(), process.pid());
 
     auto current = getCurrent(newState);
     auto next = schedule(newState);
@@ -96,15 +95,18 @@ protected:
     if (next) {
       auto [pid, queue] = next.value();
       auto processIndex = getIndexByPid(newState, pid);
-      auto process = newState.processes.at(*processIndex);
+      const auto &process = newState.processes.at(*processIndex);
 
       if (!current) {
-        newState = popFromQueue(newState, queue);
-        newState = switchTo(newState, pid);
+        newState = popFromQueue(std::move(newState), queue);
+        newState = switchTo(std::move(newState), pid);
       } else if (current && process.priority() > current->priority()) {
-        newState = pushToQueue(newState, current->priority(), current->pid());
-        newState = popFromQueue(newState, queue);
-        newState = switchTo(newState, pid);
+        auto currentPriority = current->priority();
+        auto currentPid = current->pid();
+        newState =
+            pushToQueue(std::move(newState), currentPriority, currentPid);
+        newState = popFromQueue(std::move(newState), queue);
+        newState = switchTo(std::move(newState), pid);
       }
     } else {
       return newState;
@@ -114,52 +116,53 @@ protected:
   }
 
   ProcessesState processRequest(const TerminateProcessReq &request,
-                                const ProcessesState &state) const override {
-    auto newState = state;
+                                ProcessesState state) const override {
+    auto newState = std::move(state);
 
     if (!getIndexByPid(newState, request.pid())) {
       return newState;
     }
 
-    newState = terminateProcess(newState, request.pid());
+    newState = terminateProcess(std::move(newState), request.pid());
 
     auto current = getCurrent(newState);
     auto next = schedule(newState);
     if (!current && next) {
       auto [pid, queue] = next.value();
-      newState = popFromQueue(newState, queue);
-      newState = switchTo(newState, pid);
+      newState = popFromQueue(std::move(newState), queue);
+      newState = switchTo(std::move(newState), pid);
     }
     return newState;
   }
 
   ProcessesState processRequest(const InitIO &request,
-                                const ProcessesState &state) const override {
-    auto newState = state;
+                                ProcessesState state) const override {
+    auto newState = std::move(state);
     auto processIndex = getIndexByPid(newState, request.pid());
 
     if (!processIndex) {
       return newState;
     }
-    if (auto process = newState.processes.at(*processIndex);
+    if (const auto &process = newState.processes.at(*processIndex);
         process.state() != ProcState::EXECUTING) {
       return newState;
     }
 
-    newState = changeProcessState(newState, request.pid(), ProcState::WAITING);
+    newState = changeProcessState(
+        std::move(newState), request.pid(), ProcState::WAITING);
 
     auto next = schedule(newState);
     if (next) {
       auto [pid, queue] = next.value();
-      newState = popFromQueue(newState, queue);
-      newState = switchTo(newState, pid);
+      newState = popFromQueue(std::move(newState), queue);
+      newState = switchTo(std::move(newState), pid);
     }
     return newState;
   }
 
   ProcessesState processRequest(const TerminateIO &request,
-                                const ProcessesState &state) const override {
-    auto newState = state;
+                                ProcessesState state) const override {
+    auto newState = std::move(state);
     auto processIndex = getIndexByPid(newState, request.pid());
 
     if (!processIndex) {
@@ -173,8 +176,9 @@ protected:
     auto newPriority = std::min(newState.queues.size() - 1,
                                 process.priority() + request.augment());
 
-    newState = pushToQueue(newState, newPriority, request.pid());
-    newState = changeProcessState(newState, request.pid(), ProcState::ACTIVE);
+    newState = pushToQueue(std::move(newState), newPriority, request.pid());
+    newState = changeProcessState(
+        std::move(newState), request.pid(), ProcState::ACTIVE);
 
     auto current = getCurrent(newState);
     auto next = schedule(newState);
@@ -182,15 +186,18 @@ protected:
     if (next) {
       auto [pid, queue] = next.value();
       auto processIndex = getIndexByPid(newState, pid);
-      auto process = newState.processes.at(*processIndex);
+      const auto &process = newState.processes.at(*processIndex);
 
       if (!current) {
-        newState = popFromQueue(newState, queue);
-        newState = switchTo(newState, pid);
+        newState = popFromQueue(std::move(newState), queue);
+        newState = switchTo(std::move(newState), pid);
       } else if (current && process.priority() > current->priority()) {
-        newState = pushToQueue(newState, current->priority(), current->pid());
-        newState = popFromQueue(newState, queue);
-        newState = switchTo(newState, pid);
+        auto currentPriority = current->priority();
+        auto currentPid = current->pid();
+        newState =
+            pushToQueue(std::move(newState), currentPriority, currentPid);
+        newState = popFromQueue(std::move(newState), queue);
+        newState = switchTo(std::move(newState), pid);
       }
     } else {
       return newState;
@@ -200,8 +207,8 @@ protected:
   }
 
   ProcessesState processRequest(const TransferControl &request,
-                                const ProcessesState &state) const override {
-    auto newState = state;
+                                ProcessesState state) const override {
+    auto newState = std::move(state);
     auto processIndex = getIndexByPid(newState, request.pid());
 
     if (!processIndex) {
@@ -216,32 +223,32 @@ protected:
         std::max(process.basePriority(),
                  process.priority() == 0 ? 0 : process.priority() - 1);
 
-    newState = pushToQueue(newState, newPriority, request.pid());
+    newState = pushToQueue(std::move(newState), newPriority, request.pid());
 
     auto next = schedule(newState);
     if (next) {
       auto [pid, queue] = next.value();
-      newState = popFromQueue(newState, queue);
-      newState = switchTo(newState, pid);
+      newState = popFromQueue(std::move(newState), queue);
+      newState = switchTo(std::move(newState), pid);
     }
     return newState;
   }
 
   ProcessesState processRequest(const TimeQuantumExpired &,
-                                const ProcessesState &state) const override {
-    auto newState = state;
-    auto current = getCurrent(newState);
-    if (current) {
+                                ProcessesState state) const override {
+    auto newState = std::move(state);
+    if (auto current = getCurrent(newState); current) {
       auto newPriority =
           std::max(current->basePriority(),
                    current->priority() == 0 ? 0 : current->priority() - 1);
-      newState = pushToQueue(newState, newPriority, current->pid());
+      auto pid = current->pid();
+      newState = pushToQueue(std::move(newState), newPriority, pid);
     }
     auto next = schedule(newState);
     if (next) {
       auto [pid, queue] = next.value();
-      newState = popFromQueue(newState, queue);
-      newState = switchTo(newState, pid);
+      newState = popFromQueue(std::move(newState), queue);
+      newState = switchTo(std::move(newState), pid);
     }
     return newState;
   }
@@ -1,16 +1,22 @@
 #pragma once
 
-#include <array>
+#include <algorithm>
 #include <cstddef>
 #include <cstdint>
 #include <deque>
 #include <vector>
 #include <map>
-#include <set>
 #include <string>
 #include <tuple>
+#include <type_traits>
+#include <utility>
 
 #include <nlohmann/json.hpp>
+#include <tl/optional.hpp>
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
 
 #include "exceptions.h"
 
@@ -18,6 +24,86 @@ namespace ProcessesManagement {
 
 enum class ProcState { ACTIVE, EXECUTING, WAITING };
 
+/**
+ *  @brief Параметры модели процессов.
+ *
+ *  Модель содержит @a priorities уровней приоритета (по одной очереди на
+ *  уровень) и допускает идентификаторы процессов от 0 до @a pids - 1. По
+ *  умолчанию используются 16 уровней приоритета и PID от 0 до 255.
+ */
+class ProcessesConfig {
+private:
+  int32_t _priorities;
+
+  int32_t _pids;
+
+public:
+  static constexpr int32_t DEFAULT_PRIORITIES = 16;
+
+  static constexpr int32_t DEFAULT_PIDS = 256;
+
+  int32_t priorities() const { return _priorities; }
+
+  int32_t pids() const { return _pids; }
+
+  /**
+   *  Возвращает наибольший допустимый приоритет.
+   */
+  size_t maxPriority() const { return static_cast<size_t>(_priorities - 1); }
+
+  /**
+   *  Возвращает наибольший допустимый идентификатор процесса.
+   */
+  int32_t maxPid() const { return _pids - 1; }
+
+  /**
+   *  @brief Создает дескриптор параметров модели процессов.
+   *
+   *  @param priorities Количество уровней приоритета (очередей).
+   *  @param pids Количество допустимых идентификаторов процессов.
+   */
+  ProcessesConfig(int32_t priorities, int32_t pids)
+      : _priorities(priorities), _pids(pids) {
+    validate(priorities, pids);
+  }
+
+  ProcessesConfig() : ProcessesConfig(DEFAULT_PRIORITIES, DEFAULT_PIDS) {}
+
+  bool operator==(const ProcessesConfig &rhs) const {
+    return _priorities == rhs._priorities && _pids == rhs._pids;
+  }
+
+  bool operator!=(const ProcessesConfig &rhs) const { return !(*this == rhs); }
+
+  /**
+   *  Возвращает дескриптор в виде JSON-объекта.
+   */
+  nlohmann::json dump() const {
+    return {{"priorities", _priorities}, {"pids", _pids}};
+  }
+
+  /**
+   *  @brief Проверяет параметры конструктора.
+   *
+   *  Стратегии FCFS и LinuxO1 используют две очереди, поэтому уровней
+   *  приоритета должно быть не меньше двух.
+   *
+   *  @param priorities Количество уровней приоритета (очередей).
+   *  @param pids Количество допустимых идентификаторов процессов.
+   *
+   *  @throws ProcessesManagement::TypeException Исключение возникает, если
+   *  переданные параметры не соответствуют заданным ограничениям.
+   */
+  static void validate(int32_t priorities, int32_t pids) {
+    if (priorities < 2) {
+      throw TypeException("INVALID_PRIORITIES");
+    }
+    if (pids < 1) {
+      throw TypeException("INVALID_PIDS");
+    }
+  }
+};
+
 /**
  *  @brief Дескриптор процесса.
  */
@@ -105,14 +191,16 @@ public:
    *  @brief Изменяет идентификатор родительского процесса.
    *
    *  @param ppid Идентификатор нового родительского процесса.
+   *  @param config Параметры модели процессов.
    *
    *  @return Дескриптор измененного процесса.
    *
    *  @throws ProcessesManagement::TypeException Исключение возникает, если
    *  переданные параметры не соответствуют заданным ограничениям.
    */
-  Process ppid(int32_t ppid) const {
-    if (ppid < -1 || ppid > 255) {
+  Process ppid(int32_t ppid,
+               const ProcessesConfig &config = ProcessesConfig()) const {
+    if (ppid < -1 || ppid > config.maxPid()) {
       throw TypeException("INVALID_PPID");
     }
 
@@ -126,14 +214,16 @@ public:
    *  @brief Изменяет приоритет процесса.
    *
    *  @param priority Новый приоритет процесса.
+   *  @param config Параметры модели процессов.
    *
    *  @return Дескриптор измененного процесса.
    *
    *  @throws ProcessesManagement::TypeException Исключение возникает, если
    *  переданные параметры не соответствуют заданным ограничениям.
    */
-  Process priority(size_t priority) const {
-    if (priority > 15 || _basePriority > priority) {
+  Process priority(size_t priority,
+                   const ProcessesConfig &config = ProcessesConfig()) const {
+    if (priority > config.maxPriority() || _basePriority > priority) {
       throw TypeException("INVALID_PRIORITY");
     }
 
@@ -147,14 +237,17 @@ public:
    *  @brief Изменяет базовый приоритет процесса.
    *
    *  @param basePriority Новый базовый приоритет процесса.
+   *  @param config Параметры модели процессов.
    *
    *  @return Дескриптор измененного процесса.
    *
    *  @throws ProcessesManagement::TypeException Исключение возникает, если
    *  переданные параметры не соответствуют заданным ограничениям.
    */
-  Process basePriority(size_t basePriority) const {
-    if (basePriority > 15 || basePriority > _priority) {
+  Process
+  basePriority(size_t basePriority,
+               const ProcessesConfig &config = ProcessesConfig()) const {
+    if (basePriority > config.maxPriority() || basePriority > _priority) {
       throw TypeException("INVALID_BASE_PRIORITY");
     }
 
@@ -210,14 +303,16 @@ public:
    *  @brief Изменяет идентификатор процесса.
    *
    *  @param pid Новый идентификатор процесса.
+   *  @param config Параметры модели процессов.
    *
    *  @return Дескриптор измененного процесса.
    *
    *  @throws ProcessesManagement::TypeException Исключение возникает, если
    *  переданные параметры не соответствуют заданным ограничениям.
    */
-  Process pid(int32_t pid) const {
-    if (pid < 0 || pid > 255) {
+  Process pid(int32_t pid,
+              const ProcessesConfig &config = ProcessesConfig()) const {
+    if (pid < 0 || pid > config.maxPid()) {
       throw TypeException("INVALID_PID");
     }
 
@@ -274,38 +369,101 @@ public:
  *  @brief Дескриптор состояния процессов.
  *
  *  Процессам в данной модели могут присваиваться идентификаторы (PID) от 0 до
- *  255 включительно.
+ *  config.maxPid() включительно, количество очередей равно количеству уровней
+ *  приоритета config.priorities() (по умолчанию PID от 0 до 255 и 16
+ *  очередей, см. ProcessesConfig).
  *
  *  Программная модель разработана исходя из того, что перед обработкой первой
  *  заявки очереди пусты и ни один процесс не создан.
+ *
+ *  Для поиска процесса по PID и выполняющегося процесса за O(1) дескриптор
+ *  хранит индекс: PID -> позиция в списке processes, PID -> номер очереди, в
+ *  которой находится процесс, позицию процесса в состоянии
+ *  ProcState::EXECUTING, битовую карту непустых очередей и дерево процессов
+ *  (списки дочерних процессов по PPID). Индекс строится конструктором и
+ *  поддерживается методами setProcess(), insertProcess(), enqueue(), dequeue(),
+ *  swapQueues(), removeProcesses() и операциями из operations.h. После
+ *  изменения списка processes или очередей напрямую необходимо вызвать
+ *  reindex(). В сравнении дескрипторов и JSON-представлении индекс не
+ *  участвует.
+ *
+ *  Для совместимости со структурным связыванием (auto [processes, queues] =
+ *  state) дескриптор реализует протокол кортежа из двух элементов.
  */
 class ProcessesState {
 public:
   std::vector<Process> processes;
 
-  std::array<std::deque<int32_t>, 16> queues;
+  std::vector<std::deque<int32_t>> queues;
 
+  ProcessesConfig config;
+
+private:
+  std::vector<int32_t> _slots;
+
+  std::vector<int32_t> _queueOf;
+
+  std::vector<uint64_t> _nonEmptyQueues;
+
+  std::vector<int32_t> _firstChild;
+
+  std::vector<int32_t> _nextSibling;
+
+  std::vector<int32_t> _prevSibling;
+
+  mutable std::vector<uint32_t> _visited;
+
+  mutable uint32_t _walk = 0;
+
+  int32_t _executing = -1;
+
+  int32_t _executingCount = 0;
+
+  bool _sorted = true;
+
+public:
   /**
    *  @brief Создает дескриптор состояния процессов с заданными параметрами.
    *
+   *  Если очередей меньше, чем уровней приоритета, недостающие очереди
+   *  считаются пустыми. Конструктор объявлен шаблоном, чтобы список
+   *  инициализации вида {{0, {1}}} однозначно передавался в конструктор с
+   *  отображением очередей.
+   *
    *  @param processes Список дескрипторов процессов.
    *  @param queues Список очередй.
+   *  @param config Параметры модели процессов.
    */
-  ProcessesState(const std::vector<Process> &processes,
-                 const std::array<std::deque<int32_t>, 16> &queues)
-      : processes(processes), queues(queues) {}
+  template <class Queues,
+            std::enable_if_t<
+                std::is_same_v<Queues, std::vector<std::deque<int32_t>>>,
+                int> = 0>
+  ProcessesState(std::vector<Process> processes,
+                 Queues queues,
+                 const ProcessesConfig &config = ProcessesConfig())
+      : processes(std::move(processes)), queues(std::move(queues)),
+        config(config) {
+    if (this->queues.size() < static_cast<size_t>(config.priorities())) {
+      this->queues.resize(static_cast<size_t>(config.priorities()));
+    }
+    reindex();
+  }
 
   /**
    *  @brief Создает дескриптор состояния процессов с заданными параметрами.
    *  @param processes Список дескрипторов процессов.
    *  @param queues Отображение вида <индекс очереди> -> <список PID'ов>.
+   *  @param config Параметры модели процессов.
    */
-  ProcessesState(const std::vector<Process> &processes,
-                 const std::map<size_t, std::deque<int32_t>> &queues)
-      : processes(processes), queues() {
+  ProcessesState(std::vector<Process> processes,
+                 const std::map<size_t, std::deque<int32_t>> &queues,
+                 const ProcessesConfig &config = ProcessesConfig())
+      : processes(std::move(processes)),
+        queues(static_cast<size_t>(config.priorities())), config(config) {
     for (const auto &queue : queues) {
       this->queues.at(queue.first) = queue.second;
     }
+    reindex();
   }
 
   ProcessesState() : ProcessesState(ProcessesState::initial()) {}
@@ -319,13 +477,378 @@ public:
   ProcessesState &operator=(ProcessesState &&state) = default;
 
   bool operator==(const ProcessesState &state) const {
-    return processes == state.processes && queues == state.queues;
+    return processes == state.processes && queues == state.queues &&
+           config == state.config;
   }
 
   bool operator!=(const ProcessesState &state) const {
     return !(*this == state);
   }
 
+  template <std::size_t I> auto &get() & {
+    if constexpr (I == 0) {
+      return processes;
+    } else {
+      return queues;
+    }
+  }
+
+  template <std::size_t I> const auto &get() const & {
+    if constexpr (I == 0) {
+      return processes;
+    } else {
+      return queues;
+    }
+  }
+
+  template <std::size_t I> auto &&get() && {
+    if constexpr (I == 0) {
+      return std::move(processes);
+    } else {
+      return std::move(queues);
+    }
+  }
+
+  /**
+   *  @brief Находит позицию процесса в списке processes за O(1).
+   *
+   *  @param pid Идентификатор процесса.
+   *
+   *  @return Индекс дескриптора процесса или tl::nullopt, если процесса с
+   *  таким @a pid не существует.
+   */
+  tl::optional<std::size_t> indexOf(int32_t pid) const {
+    if (pid < 0 || static_cast<std::size_t>(pid) >= _slots.size() ||
+        _slots[pid] == -1) {
+      return tl::nullopt;
+    }
+    return static_cast<std::size_t>(_slots[pid]);
+  }
+
+  /**
+   *  @brief Находит очередь, в которой находится процесс, за O(1).
+   *
+   *  @param pid Идентификатор процесса.
+   *
+   *  @return Номер очереди или tl::nullopt, если процесса нет в очередях.
+   */
+  tl::optional<std::size_t> queueOf(int32_t pid) const {
+    if (pid < 0 || static_cast<std::size_t>(pid) >= _queueOf.size() ||
+        _queueOf[pid] == -1) {
+      return tl::nullopt;
+    }
+    return static_cast<std::size_t>(_queueOf[pid]);
+  }
+
+  /**
+   *  @brief Добавляет процесс в конец очереди, поддерживая индекс.
+   *
+   *  @param queueIndex Номер очереди.
+   *  @param pid Идентификатор процесса.
+   */
+  void enqueue(std::size_t queueIndex, int32_t pid) {
+    queues.at(queueIndex).push_back(pid);
+    setQueueOf(_queueOf, pid, static_cast<int32_t>(queueIndex));
+    markQueue(queueIndex);
+  }
+
+  /**
+   *  @brief Извлекает процесс из начала непустой очереди, поддерживая
+   *  индекс.
+   *
+   *  @param queueIndex Номер очереди.
+   *
+   *  @return Идентификатор извлеченного процесса.
+   */
+  int32_t dequeue(std::size_t queueIndex) {
+    auto &queue = queues.at(queueIndex);
+    auto pid = queue.front();
+    queue.pop_front();
+    if (queueOf(pid) == queueIndex) {
+      _queueOf[pid] = -1;
+    }
+    markQueue(queueIndex);
+    return pid;
+  }
+
+  /**
+   *  @brief Меняет местами содержимое двух очередей, поддерживая индекс.
+   *
+   *  Очереди обмениваются хранилищем без копирования элементов, в таблице
+   *  очередей обновляются только записи перемещенных процессов.
+   *
+   *  @param first Номер первой очереди.
+   *  @param second Номер второй очереди.
+   */
+  void swapQueues(std::size_t first, std::size_t second) {
+    queues.at(first).swap(queues.at(second));
+    for (auto queueIndex : {first, second}) {
+      for (auto pid : queues[queueIndex]) {
+        setQueueOf(_queueOf, pid, static_cast<int32_t>(queueIndex));
+      }
+      markQueue(queueIndex);
+    }
+  }
+
+  /**
+   *  @brief Находит непустую очередь с наибольшим номером за O(1) (поиском
+   *  старшего установленного бита в битовой карте непустых очередей).
+   *
+   *  @return Номер очереди или tl::nullopt, если все очереди пусты.
+   */
+  tl::optional<std::size_t> highestNonEmptyQueue() const {
+    for (auto index = _nonEmptyQueues.size(); index > 0; --index) {
+      if (auto word = _nonEmptyQueues[index - 1]; word != 0) {
+        return (index - 1) * 64 + highestBit(word);
+      }
+    }
+    return tl::nullopt;
+  }
+
+  /**
+   *  @brief Возвращает позицию первого по списку процесса в состоянии
+   *  ProcState::EXECUTING за O(1).
+   *
+   *  @return Индекс дескриптора процесса или tl::nullopt, если такого
+   *  процесса нет.
+   */
+  tl::optional<std::size_t> executingIndex() const {
+    if (_executing == -1) {
+      return tl::nullopt;
+    }
+    return static_cast<std::size_t>(_executing);
+  }
+
+  /**
+   *  @brief Заменяет дескриптор процесса, поддерживая индекс.
+   *
+   *  @param index Позиция дескриптора в списке processes.
+   *  @param process Новый дескриптор процесса.
+   */
+  void setProcess(std::size_t index, const Process &process) {
+    auto &current = processes.at(index);
+    auto position = static_cast<int32_t>(index);
+    auto relink =
+        current.pid() != process.pid() || current.ppid() != process.ppid();
+    if (relink && indexOf(current.pid()) == index) {
+      unlinkChild(current.pid(), current.ppid());
+    }
+    if (current.pid() != process.pid()) {
+      if (auto owner = indexOf(process.pid()); owner.has_value()) {
+        unlinkChild(process.pid(), processes[*owner].ppid());
+      }
+      _slots[current.pid()] = -1;
+      insertSlot(process.pid(), position);
+    }
+
+    if (current.pid() != process.pid()) {
+      // порядок по PID может нарушиться только рядом с измененным процессом
+      _sorted = _sorted &&
+                (index == 0 || processes[index - 1].pid() <= process.pid()) &&
+                (index + 1 == processes.size() ||
+                 process.pid() <= processes[index + 1].pid());
+    }
+
+    auto wasExecuting = current.state() == ProcState::EXECUTING;
+    auto isExecuting = process.state() == ProcState::EXECUTING;
+    current = process;
+    if (relink) {
+      linkChild(process.pid(), process.ppid());
+    }
+    if (isExecuting && !wasExecuting) {
+      _executingCount += 1;
+      if (_executing == -1 || position < _executing) {
+        _executing = position;
+      }
+    } else if (wasExecuting && !isExecuting) {
+      _executingCount -= 1;
+      if (_executing == position) {
+        // в корректном состоянии выполняется не более одного процесса,
+        // поэтому поиск следующего выполняется только в некорректных
+        _executing = _executingCount == 0 ? -1 : findExecuting();
+      }
+    }
+  }
+
+  /**
+   *  @brief Добавляет процесс в список processes с сохранением порядка по PID.
+   *
+   *  Позиция процесса находится двоичным поиском, индекс обновляется только
+   *  для процессов, стоящих после нее. Упорядоченность списка processes
+   *  проверяется при построении индекса (см. reindex()) и поддерживается
+   *  методами дескриптора; если список не упорядочен по PID, он сортируется
+   *  целиком.
+   *
+   *  @param process Дескриптор процесса.
+   */
+  void insertProcess(const Process &process) {
+    if (!_sorted) {
+      processes.push_back(process);
+      std::sort(processes.begin(), processes.end());
+      reindex();
+      return;
+    }
+
+    auto it = std::upper_bound(
+        processes.begin(),
+        processes.end(),
+        process,
+        [](const Process &lhs, const Process &rhs) {
+          return lhs.pid() < rhs.pid();
+        });
+    auto position = static_cast<int32_t>(it - processes.begin());
+    processes.insert(it, process);
+    for (auto index = static_cast<std::size_t>(position) + 1;
+         index < processes.size(); ++index) {
+      auto pid = processes[index].pid();
+      if (_slots[pid] == static_cast<int32_t>(index) - 1) {
+        _slots[pid] = static_cast<int32_t>(index);
+      }
+    }
+    if (_executing >= position) {
+      _executing += 1;
+    }
+
+    if (!indexOf(process.pid()).has_value()) {
+      insertSlot(process.pid(), position);
+      linkChild(process.pid(), process.ppid());
+    }
+    if (process.state() == ProcState::EXECUTING) {
+      _executingCount += 1;
+      if (_executing == -1 || position < _executing) {
+        _executing = position;
+      }
+    }
+  }
+
+  /**
+   *  @brief Возвращает PID процесса и всех его потомков.
+   *
+   *  Дерево обходится в ширину без рекурсии по спискам дочерних процессов.
+   *  Посещенные процессы отмечаются номером обхода, поэтому отметки не
+   *  сбрасываются перед каждым обходом и время обхода пропорционально
+   *  размеру поддерева.
+   *
+   *  @param pid Идентификатор процесса.
+   */
+  std::vector<int32_t> subtree(int32_t pid) const {
+    std::vector<int32_t> result{pid};
+    // PPID образуют цикл, если процесс был завершен без дочерних и создан
+    // заново потомком одного из них
+    if (_visited.size() < _firstChild.size()) {
+      _visited.resize(_firstChild.size(), 0);
+    }
+    if (++_walk == 0) {
+      std::fill(_visited.begin(), _visited.end(), 0);
+      _walk = 1;
+    }
+    for (std::size_t i = 0; i < result.size(); ++i) {
+      auto parent = result[i];
+      if (static_cast<std::size_t>(parent) >= _firstChild.size()) {
+        continue;
+      }
+      _visited[parent] = _walk;
+      for (auto child = _firstChild[parent]; child != -1;
+           child = _nextSibling[child]) {
+        if (_visited[child] != _walk) {
+          _visited[child] = _walk;
+          result.push_back(child);
+        }
+      }
+    }
+    return result;
+  }
+
+  /**
+   *  @brief Удаляет процессы из списка processes и из очередей, поддерживая
+   *  индекс.
+   *
+   *  Из очередей процессы удаляются по таблице очередей, список processes
+   *  уплотняется за один проход с сохранением порядка.
+   *
+   *  @param pids Идентификаторы удаляемых процессов.
+   */
+  void removeProcesses(const std::vector<int32_t> &pids) {
+    std::vector<bool> removed;
+    for (auto pid : pids) {
+      if (auto queueIndex = queueOf(pid); queueIndex.has_value()) {
+        auto &queue = queues[*queueIndex];
+        queue.erase(std::remove(queue.begin(), queue.end(), pid), queue.end());
+        _queueOf[pid] = -1;
+        markQueue(*queueIndex);
+      }
+      if (auto index = indexOf(pid); index.has_value()) {
+        unlinkChild(pid, processes[*index].ppid());
+        if (static_cast<std::size_t>(pid) >= removed.size()) {
+          removed.resize(static_cast<std::size_t>(pid) + 1);
+        }
+        removed[pid] = true;
+      }
+    }
+
+    std::size_t position = 0;
+    _executing = -1;
+    _executingCount = 0;
+    for (std::size_t index = 0; index < processes.size(); ++index) {
+      auto pid = processes[index].pid();
+      if (static_cast<std::size_t>(pid) < removed.size() && removed[pid]) {
+        _slots[pid] = -1;
+        continue;
+      }
+      if (position != index) {
+        processes[position] = std::move(processes[index]);
+        if (_slots[pid] == static_cast<int32_t>(index)) {
+          _slots[pid] = static_cast<int32_t>(position);
+        }
+      }
+      if (processes[position].state() == ProcState::EXECUTING) {
+        if (_executing == -1) {
+          _executing = static_cast<int32_t>(position);
+        }
+        _executingCount += 1;
+      }
+      ++position;
+    }
+    processes.resize(position);
+  }
+
+  /**
+   *  Строит индекс процессов заново по списку processes и проверяет, упорядочен
+   *  ли он по PID.
+   */
+  void reindex() {
+    _slots.assign(_slots.size(), -1);
+    _firstChild.assign(_firstChild.size(), -1);
+    _nextSibling.assign(_nextSibling.size(), -1);
+    _prevSibling.assign(_prevSibling.size(), -1);
+    fillQueueTable(queues, _queueOf, config.maxPid());
+    _nonEmptyQueues.assign((queues.size() + 63) / 64, 0);
+    for (std::size_t queueIndex = 0; queueIndex < queues.size(); ++queueIndex) {
+      markQueue(queueIndex);
+    }
+    _executing = -1;
+    _executingCount = 0;
+    _sorted = true;
+    for (std::size_t index = 0; index < processes.size(); ++index) {
+      const auto &process = processes[index];
+      if (index > 0 && process.pid() < processes[index - 1].pid()) {
+        _sorted = false;
+      }
+      // при повторе PID (некорректное состояние) индекс указывает на первый
+      // процесс, как и поиск перебором
+      if (!indexOf(process.pid()).has_value()) {
+        insertSlot(process.pid(), static_cast<int32_t>(index));
+        linkChild(process.pid(), process.ppid());
+      }
+      if (process.state() == ProcState::EXECUTING) {
+        if (_executing == -1) {
+          _executing = static_cast<int32_t>(index);
+        }
+        _executingCount += 1;
+      }
+    }
+  }
+
   /**
    *  Возвращает дескриптор в виде JSON-объекта.
    */
@@ -344,10 +867,13 @@ public:
   }
 
   /**
-   *  Возвращает дескриптор с начальным состоянием.
+   *  @brief Возвращает дескриптор с начальным состоянием.
+   *
+   *  @param config Параметры модели процессов.
    */
-  static ProcessesState initial() {
-    return {{}, std::array<std::deque<int32_t>, 16>{}};
+  static ProcessesState
+  initial(const ProcessesConfig &config = ProcessesConfig()) {
+    return {{}, std::vector<std::deque<int32_t>>(), config};
   }
 
   /**
@@ -355,69 +881,207 @@ public:
    *
    *  @param processes Список дескрипторов процессов.
    *  @param queues Список очередй.
+   *  @param config Параметры модели процессов.
    *
    *  @throws ProcessesManagement::TypeException Исключение возникает, если
    *  переданные параметры не соответствуют заданным ограничениям.
    */
   static void validate(const std::vector<Process> &processes,
-                       const std::array<std::deque<int32_t>, 16> &queues) {
-    std::set<int32_t> pidsInQueues, pidsOfProcesses, activePids;
-    std::map<size_t, std::set<int32_t>> queuesMap;
+                       const std::vector<std::deque<int32_t>> &queues,
+                       const ProcessesConfig &config = ProcessesConfig()) {
+    std::vector<bool> pidsOfProcesses(static_cast<size_t>(config.pids()));
+    std::vector<int32_t> queueOf;
+    std::size_t activeCount = 0;
+
+    // Очередей должно быть столько же, сколько уровней приоритета.
+    if (queues.size() != static_cast<size_t>(config.priorities())) {
+      throw TypeException("INVALID_STATE");
+    }
 
-    // В списке процессов не должно быть двух процессов с одинаковым PID.
+    // PID и приоритеты должны находится в допустимых пределах. В списке
+    // процессов не должно быть двух процессов с одинаковым PID.
     for (const auto &process : processes) {
-      if (pidsOfProcesses.find(process.pid()) != pidsOfProcesses.end()) {
+      if (process.pid() > config.maxPid() ||
+          process.ppid() > config.maxPid() ||
+          process.priority() > config.maxPriority() ||
+          pidsOfProcesses[process.pid()]) {
         throw TypeException("INVALID_STATE");
-      } else {
-        pidsOfProcesses.insert(process.pid());
       }
+      pidsOfProcesses[process.pid()] = true;
     }
 
-    // Собираем список процессов в состоянии ACTIVE.
+    // Проверяем на существование родительских процессов.
     for (const auto &process : processes) {
-      if (process.state() == ProcState::ACTIVE) {
-        activePids.insert(process.pid());
+      if (process.ppid() != -1 && !pidsOfProcesses[process.ppid()]) {
+        throw TypeException("INVALID_STATE");
       }
     }
 
-    // Проверяем на существование родительских процессов.
+    // Собираем таблицу очередей. Каждый процесс должен находится только в
+    // одной очереди.
+    auto queuedCount = fillQueueTable(queues, queueOf, config.maxPid());
+    if (!queuedCount.has_value()) {
+      throw TypeException("INVALID_STATE");
+    }
+
+    // Процессы с состоянием ACTIVE должны находится в очереди, индекс которой
+    // равен приоритету процесса.
     for (const auto &process : processes) {
-      if (process.ppid() != -1 &&
-          pidsOfProcesses.find(process.ppid()) == pidsOfProcesses.end()) {
+      if (process.state() != ProcState::ACTIVE) {
+        continue;
+      }
+      auto pid = static_cast<std::size_t>(process.pid());
+      if (pid >= queueOf.size() ||
+          queueOf[pid] != static_cast<int32_t>(process.priority())) {
         throw TypeException("INVALID_STATE");
       }
+      activeCount += 1;
     }
 
-    // Собираем множество процессов, находящихся в очередях.
-    for (size_t i = 0; i < queues.size(); ++i) {
-      const auto &queue = queues[i];
-      for (const auto &pid : queue) {
-        // Каждый процесс должен находится только в одной очереди.
-        if (pidsInQueues.find(pid) != pidsInQueues.end()) {
-          throw TypeException("INVALID_STATE");
+    // Только процессы с состоянием ACTIVE могут находится в очередях.
+    if (activeCount != *queuedCount) {
+      throw TypeException("INVALID_STATE");
+    }
+  }
+
+private:
+  static void setQueueOf(std::vector<int32_t> &table,
+                         int32_t pid,
+                         int32_t queueIndex) {
+    if (static_cast<std::size_t>(pid) >= table.size()) {
+      table.resize(static_cast<std::size_t>(pid) + 1, -1);
+    }
+    table[pid] = queueIndex;
+  }
+
+  /**
+   *  @brief Заполняет таблицу PID -> номер очереди, в которой находится
+   *  процесс (-1, если процесса нет в очередях).
+   *
+   *  @param queues Очереди процессов.
+   *  @param table Таблица очередей.
+   *  @param maxPid Наибольший допустимый PID.
+   *
+   *  @return Количество процессов в очередях или tl::nullopt, если в очередях
+   *  есть некорректный PID или процесс находится в очередях несколько раз. В
+   *  последнем случае таблица указывает на первую очередь с процессом.
+   */
+  static tl::optional<std::size_t>
+  fillQueueTable(const std::vector<std::deque<int32_t>> &queues,
+                 std::vector<int32_t> &table,
+                 int32_t maxPid) {
+    table.assign(table.size(), -1);
+    std::size_t count = 0;
+    bool valid = true;
+    for (std::size_t i = 0; i < queues.size(); ++i) {
+      for (auto pid : queues[i]) {
+        if (pid < 0 || pid > maxPid) {
+          valid = false;
+        } else if (static_cast<std::size_t>(pid) < table.size() &&
+                   table[pid] != -1) {
+          valid = false;
         } else {
-          pidsInQueues.insert(pid);
+          setQueueOf(table, pid, static_cast<int32_t>(i));
         }
-        queuesMap[i].insert(pid);
+        count += 1;
       }
     }
+    if (!valid) {
+      return tl::nullopt;
+    }
+    return count;
+  }
 
-    // Только процессы с состоянием ACTIVE могут находится в очередях.
-    if (activePids != pidsInQueues) {
-      throw TypeException("INVALID_STATE");
+  void markQueue(std::size_t queueIndex) {
+    auto bit = uint64_t(1) << (queueIndex % 64);
+    if (queues[queueIndex].empty()) {
+      _nonEmptyQueues[queueIndex / 64] &= ~bit;
+    } else {
+      _nonEmptyQueues[queueIndex / 64] |= bit;
     }
+  }
 
-    // Проверяем процессы на соответствие приоритета и индекса очереди.
-    for (const auto &process : processes) {
-      if (process.state() != ProcState::ACTIVE) {
-        continue;
-      }
-      auto priority = process.priority();
-      const auto &queueSet = queuesMap[priority];
-      if (queueSet.find(process.pid()) == queueSet.end()) {
-        throw TypeException("INVALID_STATE");
+  static std::size_t highestBit(uint64_t word) {
+#if defined(_MSC_VER)
+    unsigned long index;
+    _BitScanReverse64(&index, word);
+    return static_cast<std::size_t>(index);
+#else
+    return static_cast<std::size_t>(63 - __builtin_clzll(word));
+#endif
+  }
+
+  void insertSlot(int32_t pid, int32_t index) {
+    if (static_cast<std::size_t>(pid) >= _slots.size()) {
+      _slots.resize(static_cast<std::size_t>(pid) + 1, -1);
+    }
+    _slots[pid] = index;
+  }
+
+  /**
+   *  Добавляет процесс @a pid в список дочерних процессов @a ppid.
+   */
+  void linkChild(int32_t pid, int32_t ppid) {
+    if (ppid == -1) {
+      return;
+    }
+    auto size = static_cast<std::size_t>(std::max(pid, ppid)) + 1;
+    if (size > _firstChild.size()) {
+      _firstChild.resize(size, -1);
+      _nextSibling.resize(size, -1);
+      _prevSibling.resize(size, -1);
+    }
+    auto next = _firstChild[ppid];
+    _nextSibling[pid] = next;
+    _prevSibling[pid] = -1;
+    if (next != -1) {
+      _prevSibling[next] = pid;
+    }
+    _firstChild[ppid] = pid;
+  }
+
+  /**
+   *  Удаляет процесс @a pid из списка дочерних процессов @a ppid.
+   */
+  void unlinkChild(int32_t pid, int32_t ppid) {
+    if (ppid == -1) {
+      return;
+    }
+    auto prev = _prevSibling[pid];
+    auto next = _nextSibling[pid];
+    if (prev != -1) {
+      _nextSibling[prev] = next;
+    } else {
+      _firstChild[ppid] = next;
+    }
+    if (next != -1) {
+      _prevSibling[next] = prev;
+    }
+    _nextSibling[pid] = -1;
+    _prevSibling[pid] = -1;
+  }
+
+  int32_t findExecuting() const {
+    for (std::size_t index = 0; index < processes.size(); ++index) {
+      if (processes[index].state() == ProcState::EXECUTING) {
+        return static_cast<int32_t>(index);
       }
     }
+    return -1;
   }
 };
 } // namespace ProcessesManagement
+
+namespace std {
+template <>
+struct tuple_size<ProcessesManagement::ProcessesState>
+    : integral_constant<size_t, 2> {};
+
+template <> struct tuple_element<0, ProcessesManagement::ProcessesState> {
+  using type = vector<ProcessesManagement::Process>;
+};
+
+template <> struct tuple_element<1, ProcessesManagement::ProcessesState> {
+  using type = vector<deque<int32_t>>;
+};
+} // namespace std
@@ -0,0 +1,169 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <stdexcept>
+#include <vector>
+
+#include <tl/optional.hpp>
+
+#include "types.h"
+
+namespace ProcessesManagement {
+/**
+ *  @brief Представление списка дескрипторов процессов только для чтения.
+ *
+ *  Представление не владеет дескрипторами (аналог std::span<const Process>) и
+ *  действительно, пока не изменен список, на который оно ссылается. Создать
+ *  представление временного списка нельзя.
+ */
+class ProcessesView {
+private:
+  const Process *_data;
+
+  std::size_t _size;
+
+public:
+  using value_type = Process;
+
+  using const_iterator = const Process *;
+
+  ProcessesView(const std::vector<Process> &processes)
+      : _data(processes.data()), _size(processes.size()) {}
+
+  ProcessesView(std::vector<Process> &&processes) = delete;
+
+  const_iterator begin() const { return _data; }
+
+  const_iterator end() const { return _data + _size; }
+
+  std::size_t size() const { return _size; }
+
+  bool empty() const { return _size == 0; }
+
+  const Process &operator[](std::size_t index) const { return _data[index]; }
+
+  /**
+   *  @brief Возвращает дескриптор процесса с проверкой индекса.
+   *
+   *  @param index Индекс дескриптора.
+   *
+   *  @throws std::out_of_range Исключение возникает, если индекс выходит за
+   *  границы списка.
+   */
+  const Process &at(std::size_t index) const {
+    if (index >= _size) {
+      throw std::out_of_range("ProcessesView::at");
+    }
+    return _data[index];
+  }
+};
+
+/**
+ *  @brief Представление очереди процессов только для чтения.
+ *
+ *  Представление не владеет очередью и действительно, пока очередь не
+ *  изменена. Создать представление временной очереди нельзя.
+ */
+class QueueView {
+private:
+  const std::deque<int32_t> *_queue;
+
+public:
+  using value_type = int32_t;
+
+  using const_iterator = std::deque<int32_t>::const_iterator;
+
+  QueueView(const std::deque<int32_t> &queue) : _queue(&queue) {}
+
+  QueueView(std::deque<int32_t> &&queue) = delete;
+
+  const_iterator begin() const { return _queue->begin(); }
+
+  const_iterator end() const { return _queue->end(); }
+
+  std::size_t size() const { return _queue->size(); }
+
+  bool empty() const { return _queue->empty(); }
+
+  int32_t front() const { return _queue->front(); }
+
+  int32_t operator[](std::size_t index) const { return (*_queue)[index]; }
+};
+
+/**
+ *  @brief Представление состояния процессов только для чтения.
+ *
+ *  Используется кодом, который только просматривает состояние: выбором
+ *  следующего процесса в стратегиях, генератором заявок. Представление
+ *  ссылается на дескриптор состояния и остается действительным, пока он не
+ *  изменен; копирование представления не копирует состояние. Создать
+ *  представление временного дескриптора нельзя.
+ */
+class StateView {
+private:
+  const ProcessesState *_state;
+
+public:
+  StateView(const ProcessesState &state) : _state(&state) {}
+
+  StateView(ProcessesState &&state) = delete;
+
+  ProcessesView processes() const { return _state->processes; }
+
+  QueueView queue(std::size_t index) const { return _state->queues[index]; }
+
+  std::size_t queuesCount() const { return _state->queues.size(); }
+
+  const ProcessesConfig &config() const { return _state->config; }
+
+  /**
+   *  @brief Находит позицию процесса в списке processes() за O(1).
+   *
+   *  @param pid Идентификатор процесса.
+   *
+   *  @return Индекс дескриптора процесса или tl::nullopt, если процесса с
+   *  таким @a pid не существует.
+   */
+  tl::optional<std::size_t> indexOf(int32_t pid) const {
+    return _state->indexOf(pid);
+  }
+
+  /**
+   *  @brief Возвращает дескриптор процесса с заданным идентификатором.
+   *
+   *  @param pid Идентификатор процесса.
+   *
+   *  @return Ссылка на дескриптор процесса или tl::nullopt, если процесса с
+   *  таким @a pid не существует.
+   */
+  tl::optional<const Process &> process(int32_t pid) const {
+    if (auto index = _state->indexOf(pid); index.has_value()) {
+      return _state->processes[*index];
+    }
+    return tl::nullopt;
+  }
+
+  /**
+   *  @brief Возвращает дескриптор выполняющегося процесса.
+   *
+   *  @return Ссылка на дескриптор процесса или tl::nullopt, если такового
+   *  нет.
+   */
+  tl::optional<const Process &> current() const {
+    if (auto index = _state->executingIndex(); index.has_value()) {
+      return _state->processes[*index];
+    }
+    return tl::nullopt;
+  }
+
+  /**
+   *  Возвращает непустую очередь с наибольшим номером или tl::nullopt, если
+   *  все очереди пусты.
+   */
+  tl::optional<std::size_t> highestNonEmptyQueue() const {
+    return _state->highestNonEmptyQueue();
+  }
+};
+} // namespace ProcessesManagement
@@ -43,7 +43,10 @@ inline MemoryTask loadMemoryTask(const nlohmann::json &obj) {
   std::map<std::string, StrategyPtr> strategies = {
       toPair(FirstAppropriateStrategy::create()),
       toPair(MostAppropriateStrategy::create()),
-      toPair(LeastAppropriateStrategy::create())};
+      toPair(LeastAppropriateStrategy::create()),
+      toPair(BuddyStrategy::create()),
+      toPair(TlsfStrategy::create()),
+      toPair(NextAppropriateStrategy::create())};
 
   auto strategyType = obj["strategy"];
   if (strategies.find(strategyType) == strategies.end()) {
@@ -59,16 +62,25 @@ inline MemoryTask loadMemoryTask(const nlohmann::json &obj) {
     fails = obj["fails"];
   }
 
+  /*
+   * Параметры адресного пространства необязательны: в заданиях, созданных
+   * до их появления, используются значения по умолчанию.
+   */
+  MemoryConfig config;
+  if (obj.contains("config")) {
+    config = MemoryConfig(obj["config"]["pages"], obj["config"]["page_size"]);
+  }
+
   std::vector<Request> requests;
   for (auto req : obj["requests"]) {
     if (req["type"] == "CREATE_PROCESS") {
-      requests.push_back(CreateProcessReq(req["pid"], req["bytes"]));
+      requests.push_back(CreateProcessReq(req["pid"], req["bytes"], config));
     } else if (req["type"] == "TERMINATE_PROCESS") {
       requests.push_back(TerminateProcessReq(req["pid"]));
     } else if (req["type"] == "ALLOCATE_MEMORY") {
-      requests.push_back(AllocateMemory(req["pid"], req["bytes"]));
+      requests.push_back(AllocateMemory(req["pid"], req["bytes"], config));
     } else if (req["type"] == "FREE_MEMORY") {
-      requests.push_back(FreeMemory(req["pid"], req["address"]));
+      requests.push_back(FreeMemory(req["pid"], req["address"], config));
     } else {
       throw TaskException("UNKNOWN_REQUEST");
     }
@@ -76,11 +88,14 @@ inline MemoryTask loadMemoryTask(const nlohmann::json &obj) {
 
   std::vector<MemoryBlock> blocks, freeBlocks;
   for (auto block : obj["state"]["blocks"]) {
-    blocks.emplace_back(block["pid"], block["address"], block["size"]);
+    blocks.emplace_back(
+        block["pid"], block["address"], block["size"], config.pages());
   }
   for (auto blockObj : obj["state"]["free_blocks"]) {
-    freeBlocks.emplace_back(
-        blockObj["pid"], blockObj["address"], blockObj["size"]);
+    freeBlocks.emplace_back(blockObj["pid"],
+                            blockObj["address"],
+                            blockObj["size"],
+                            config.pages());
   }
 
   std::vector<std::string> actions(0);
@@ -97,8 +112,12 @@ inline MemoryTask loadMemoryTask(const nlohmann::json &obj) {
     }
   }
 
-  return MemoryTask::create(
-      strategy, completed, fails, {blocks, freeBlocks}, requests, actions);
+  return MemoryTask::create(strategy,
+                            completed,
+                            fails,
+                            {blocks, freeBlocks, config},
+                            requests,
+                            actions);
 }
 
 /**
@@ -128,7 +147,8 @@ inline ProcessesTask loadProcessesTask(const nlohmann::json &obj) {
       toPair(SrtStrategy::create()),
       toPair(WinNtStrategy::create()),
       toPair(UnixStrategy::create()),
-      toPair(LinuxO1Strategy::create())};
+      toPair(LinuxO1Strategy::create()),
+      toPair(CfsStrategy::create())};
 
   auto strategyType = obj["strategy"];
   if (strategies.find(strategyType) == strategies.end()) {
@@ -144,6 +164,12 @@ inline ProcessesTask loadProcessesTask(const nlohmann::json &obj) {
     fails = obj["fails"];
   }
 
+  ProcessesConfig config;
+  if (obj.contains("config")) {
+    config =
+        ProcessesConfig(obj["config"]["priorities"], obj["config"]["pids"]);
+  }
+
   std::vector<Request> requests;
   for (auto req : obj["requests"]) {
     if (req["type"] == "CREATE_PROCESS") {
@@ -152,15 +178,16 @@ inline ProcessesTask loadProcessesTask(const nlohmann::json &obj) {
                                           req["priority"],
                                           req["basePriority"],
                                           req["timer"],
-                                          req["workTime"]));
+                                          req["workTime"],
+                                          config));
     } else if (req["type"] == "TERMINATE_PROCESS") {
-      requests.push_back(TerminateProcessReq(req["pid"]));
+      requests.push_back(TerminateProcessReq(req["pid"], config));
     } else if (req["type"] == "INIT_IO") {
-      requests.push_back(InitIO(req["pid"]));
+      requests.push_back(InitIO(req["pid"], config));
     } else if (req["type"] == "TERMINATE_IO") {
-      requests.push_back(TerminateIO(req["pid"], req["augment"]));
+      requests.push_back(TerminateIO(req["pid"], req["augment"], config));
     } else if (req["type"] == "TRANSFER_CONTROL") {
-      requests.push_back(TransferControl(req["pid"]));
+      requests.push_back(TransferControl(req["pid"], config));
     } else if (req["type"] == "TIME_QUANTUM_EXPIRED") {
       requests.push_back(TimeQuantumExpired());
     } else {
@@ -179,18 +206,19 @@ inline ProcessesTask loadProcessesTask(const nlohmann::json &obj) {
       throw TaskException("UNKNOWN_PROCSTATE");
     }
     processes.emplace_back(Process{}
-                               .pid(process["pid"])
-                               .ppid(process["ppid"])
-                               .priority(process["priority"])
-                               .basePriority(process["basePriority"])
+                               .pid(process["pid"], config)
+                               .ppid(process["ppid"], config)
+                               .priority(process["priority"], config)
+                               .basePriority(process["basePriority"], config)
                                .timer(process["timer"])
                                .workTime(process["workTime"])
                                .state(stateMap[process["state"]]));
   }
-  std::array<std::deque<int32_t>, 16> queues;
-  for (size_t i = 0; i < queues.size(); ++i) {
-    for (int32_t pid : obj["state"]["queues"][i]) {
-      queues[i].push_back(pid);
+  std::vector<std::deque<int32_t>> queues;
+  for (const auto &queue : obj["state"]["queues"]) {
+    queues.emplace_back();
+    for (int32_t pid : queue) {
+      queues.back().push_back(pid);
     }
   }
 
@@ -208,8 +236,12 @@ inline ProcessesTask loadProcessesTask(const nlohmann::json &obj) {
     }
   }
 
-  return ProcessesTask::create(
-      strategy, completed, fails, {processes, queues}, requests, actions);
+  return ProcessesTask::create(strategy,
+                               completed,
+                               fails,
+                               {processes, queues, config},
+                               requests,
+                               actions);
 }
 } // namespace Utils::details
 
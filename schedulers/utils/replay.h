@@ -0,0 +1,118 @@
+#pragma once
+
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+#include "../algo/memory/requests.h"
+#include "../algo/memory/strategies.h"
+#include "../algo/memory/types.h"
+#include "../algo/processes/requests.h"
+#include "../algo/processes/strategies.h"
+#include "../algo/processes/types.h"
+#include "exceptions.h"
+
+namespace Utils {
+/**
+ *  @brief Кэш состояний, получаемых последовательной обработкой заявок.
+ *
+ *  Кэш хранит полное состояние (контрольную точку) через каждые interval()
+ *  заявок; состояния между контрольными точками восстанавливаются обработкой
+ *  не более interval() - 1 заявок от ближайшей предшествующей точки. Точки
+ *  строятся по мере обращения к состояниям, поэтому создание кэша не требует
+ *  обработки заявок. Чем больше интервал, тем меньше памяти занимает кэш и
+ *  тем дольше восстанавливается состояние.
+ *
+ *  @tparam StrategyPtr Указатель на стратегию с методом processRequests().
+ *  @tparam State Дескриптор состояния.
+ *  @tparam Request Заявка.
+ */
+template <class StrategyPtr, class State, class Request> class ReplayCache {
+private:
+  StrategyPtr _strategy;
+
+  std::vector<Request> _requests;
+
+  std::size_t _interval;
+
+  std::vector<State> _checkpoints;
+
+public:
+  static constexpr std::size_t DEFAULT_INTERVAL = 64;
+
+  /**
+   *  @brief Создает кэш состояний.
+   *
+   *  @param strategy Стратегия, которой обрабатываются заявки.
+   *  @param requests Список заявок.
+   *  @param initial Состояние до обработки первой заявки.
+   *  @param interval Количество заявок между контрольными точками.
+   *
+   *  @throws Utils::TaskException Исключение возникает, если @a interval
+   *  равен нулю.
+   */
+  ReplayCache(StrategyPtr strategy,
+              std::vector<Request> requests,
+              State initial,
+              std::size_t interval = DEFAULT_INTERVAL)
+      : _strategy(std::move(strategy)), _requests(std::move(requests)),
+        _interval(interval) {
+    if (interval == 0) {
+      throw TaskException("INVALID_INTERVAL");
+    }
+    _checkpoints.push_back(std::move(initial));
+  }
+
+  /**
+   *  Возвращает количество заявок между контрольными точками.
+   */
+  std::size_t interval() const { return _interval; }
+
+  /**
+   *  Возвращает количество построенных контрольных точек.
+   */
+  std::size_t checkpoints() const { return _checkpoints.size(); }
+
+  /**
+   *  Возвращает количество заявок.
+   */
+  std::size_t size() const { return _requests.size(); }
+
+  /**
+   *  @brief Возвращает состояние после обработки первых @a count заявок.
+   *
+   *  Недостающие контрольные точки до @a count строятся и сохраняются.
+   *
+   *  @param count Количество обработанных заявок.
+   *
+   *  @return Дескриптор состояния.
+   *
+   *  @throws Utils::TaskException Исключение возникает, если @a count больше
+   *  количества заявок.
+   */
+  State state(std::size_t count) {
+    if (count > _requests.size()) {
+      throw TaskException("INVALID_INDEX");
+    }
+
+    auto checkpoint = count / _interval;
+    while (_checkpoints.size() <= checkpoint) {
+      auto first = _requests.begin() + (_checkpoints.size() - 1) * _interval;
+      _checkpoints.push_back(_strategy->processRequests(
+          first, first + _interval, _checkpoints.back()));
+    }
+
+    auto first = _requests.begin() + checkpoint * _interval;
+    return _strategy->processRequests(
+        first, _requests.begin() + count, _checkpoints[checkpoint]);
+  }
+};
+
+using MemoryReplayCache = ReplayCache<MemoryManagement::StrategyPtr,
+                                      MemoryManagement::MemoryState,
+                                      MemoryManagement::Request>;
+
+using ProcessesReplayCache = ReplayCache<ProcessesManagement::StrategyPtr,
+                                         ProcessesManagement::ProcessesState,
+                                         ProcessesManagement::Request>;
+} // namespace Utils
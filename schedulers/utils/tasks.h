@@ -106,7 +106,8 @@ public:
                        const Memory::MemoryState &state,
                        const std::vector<Memory::Request> &requests) {
     try {
-      Memory::MemoryState::validate(state.blocks, state.freeBlocks);
+      Memory::MemoryState::validate(
+          state.blocks, state.freeBlocks, state.config);
     } catch (Memory::BaseException &ex) {
       throw TaskException(ex.what());
     }
@@ -114,12 +115,11 @@ public:
     if (requests.size() < completed) {
       throw TaskException("INVALID_TASK");
     }
-    auto currentState = Memory::MemoryState::initial();
     try {
-      for (auto req = requests.begin(); req != requests.begin() + completed;
-           ++req) {
-        currentState = strategy->processRequest(*req, currentState);
-      }
+      auto currentState =
+          strategy->processRequests(requests.begin(),
+                                    requests.begin() + completed,
+                                    Memory::MemoryState::initial(state.config));
       if (currentState != state) {
         throw TaskException("STATE_MISMATCH");
       }
@@ -152,6 +152,8 @@ public:
 
     obj["completed"] = completed();
 
+    obj["config"] = state().config.dump();
+
     obj["state"] = state().dump();
 
     obj["fails"] = fails();
@@ -306,7 +308,9 @@ public:
                        const Processes::ProcessesState &state,
                        const std::vector<Processes::Request> &requests) {
     try {
-      Processes::ProcessesState::validate(state.processes, state.queues);
+      Processes::ProcessesState::validate(
+          state.processes, state.queues, state.config);
+      strategy->validateState(state);
     } catch (Processes::BaseException &ex) {
       throw TaskException(ex.what());
     }
@@ -314,12 +318,11 @@ public:
     if (requests.size() < completed) {
       throw TaskException("INVALID_TASK");
     }
-    auto currentState = Processes::ProcessesState::initial();
     try {
-      for (auto req = requests.begin(); req != requests.begin() + completed;
-           ++req) {
-        currentState = strategy->processRequest(*req, currentState);
-      }
+      auto currentState = strategy->processRequests(
+          requests.begin(),
+          requests.begin() + completed,
+          Processes::ProcessesState::initial(state.config));
       if (currentState != state) {
         throw TaskException("STATE_MISMATCH");
       }
@@ -340,6 +343,8 @@ public:
 
     obj["completed"] = completed();
 
+    obj["config"] = state().config.dump();
+
     obj["state"] = state().dump();
 
     obj["fails"] = fails();
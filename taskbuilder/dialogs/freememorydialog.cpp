@@ -7,11 +7,11 @@
 #include "freememorydialog.h"
 #include "ui_freememorydialog.h"
 
-FreeMemoryDialog::FreeMemoryDialog(QWidget *parent)
+FreeMemoryDialog::FreeMemoryDialog(QWidget *parent, int32_t pages)
     : QDialog(parent), ui(new Ui::FreeMemoryDialog) {
   ui->setupUi(this);
   ui->PIDEdit->setValidator(new QIntValidator(0, 255));
-  ui->addressEdit->setValidator(new QIntValidator(0, 255));
+  ui->addressEdit->setValidator(new QIntValidator(0, pages - 1));
 
   connect(ui->buttonBox,
           &QDialogButtonBox::accepted,
@@ -41,8 +41,8 @@ void FreeMemoryDialog::tryAccept() {
 FreeMemoryDialog::~FreeMemoryDialog() { delete ui; }
 
 tl::optional<std::pair<int32_t, int32_t>>
-FreeMemoryDialog::getFreeMemoryInfo(QWidget *parent) {
-  auto dialog = FreeMemoryDialog(parent);
+FreeMemoryDialog::getFreeMemoryInfo(QWidget *parent, int32_t pages) {
+  auto dialog = FreeMemoryDialog(parent, pages);
   if (dialog.exec() == QDialog::Accepted) {
     return dialog.info;
   } else {
@@ -18,10 +18,10 @@ public:
   ~FreeMemoryDialog() override;
 
   static tl::optional<std::pair<int32_t, int32_t>>
-  getFreeMemoryInfo(QWidget *parent);
+  getFreeMemoryInfo(QWidget *parent, int32_t pages);
 
 private:
-  explicit FreeMemoryDialog(QWidget *parent = nullptr);
+  explicit FreeMemoryDialog(QWidget *parent, int32_t pages);
 
   std::pair<int32_t, int32_t> info;
 
@@ -139,6 +139,13 @@ void MainWindow::createTask(QAction *action) {
         MemoryManagement::MemoryState::initial(),
         {});
     widget = new MemoryTaskBuilder(task, this);
+  } else if (action == ui->actionNA) {
+    Utils::Task task = Utils::MemoryTask::create(
+        MemoryManagement::NextAppropriateStrategy::create(),
+        0,
+        MemoryManagement::MemoryState::initial(),
+        {});
+    widget = new MemoryTaskBuilder(task, this);
   } else if (action == ui->actionLA) {
     Utils::Task task = Utils::MemoryTask::create(
         MemoryManagement::LeastAppropriateStrategy::create(),
@@ -146,6 +153,20 @@ void MainWindow::createTask(QAction *action) {
         MemoryManagement::MemoryState::initial(),
         {});
     widget = new MemoryTaskBuilder(task, this);
+  } else if (action == ui->actionBuddy) {
+    Utils::Task task = Utils::MemoryTask::create(
+        MemoryManagement::BuddyStrategy::create(),
+        0,
+        MemoryManagement::MemoryState::initial(),
+        {});
+    widget = new MemoryTaskBuilder(task, this);
+  } else if (action == ui->actionTLSF) {
+    Utils::Task task = Utils::MemoryTask::create(
+        MemoryManagement::TlsfStrategy::create(),
+        0,
+        MemoryManagement::MemoryState::initial(),
+        {});
+    widget = new MemoryTaskBuilder(task, this);
   } else if (action == ui->actionMA) {
     Utils::Task task = Utils::MemoryTask::create(
         MemoryManagement::MostAppropriateStrategy::create(),
@@ -202,6 +223,13 @@ void MainWindow::createTask(QAction *action) {
         ProcessesManagement::ProcessesState::initial(),
         {});
     widget = new ProcessesTaskBuilder(task, this);
+  } else if (action == ui->actionCFS) {
+    Utils::Task task = Utils::ProcessesTask::create(
+        ProcessesManagement::CfsStrategy::create(),
+        0,
+        ProcessesManagement::ProcessesState::initial(),
+        {});
+    widget = new ProcessesTaskBuilder(task, this);
   }
 
   attachTask(widget);
@@ -1,4 +1,5 @@
 #include <cstddef>
+#include <cstdint>
 #include <map>
 
 #include <QApplication>
@@ -29,11 +30,18 @@ using namespace QtUtils::Literals;
 static std::map<StrategyType, QString> strategyMap = {
     {StrategyType::FIRST_APPROPRIATE, "первый подходящий"},
     {StrategyType::MOST_APPROPRIATE, "наиболее подходящий"},
-    {StrategyType::LEAST_APPROPRIATE, "наименее подходящий"}};
+    {StrategyType::LEAST_APPROPRIATE, "наименее подходящий"},
+    {StrategyType::BUDDY, "система двойников"},
+    {StrategyType::TLSF, "TLSF"},
+    {StrategyType::NEXT_APPROPRIATE, "следующий подходящий"}};
 
 MemoryTaskBuilder::MemoryTaskBuilder(const Utils::Task &task, QWidget *parent)
     : AbstractTaskBuilder(parent), HistoryNavigator(task),
-      _task(task.get<Utils::MemoryTask>()), ui(new Ui::MemoryTaskBuilder) {
+      _task(task.get<Utils::MemoryTask>()),
+      replay(_task.strategy(),
+             _task.requests(),
+             MemoryState::initial(_task.state().config)),
+      ui(new Ui::MemoryTaskBuilder) {
   ui->setupUi(this);
 
   auto font = QApplication::font();
@@ -62,13 +70,9 @@ MemoryTaskBuilder::MemoryTaskBuilder(const Utils::Task &task, QWidget *parent)
 MemoryTaskBuilder::~MemoryTaskBuilder() { delete ui; }
 
 void MemoryTaskBuilder::loadTask(const Utils::MemoryTask &task) {
-  auto state = MemoryState::initial();
-
-  states.clear();
-  for (const auto &req : task.requests()) {
-    state = task.strategy()->processRequest(req, state);
-    states.push_back(state);
-  }
+  replay = Utils::MemoryReplayCache(task.strategy(),
+                                    task.requests(),
+                                    MemoryState::initial(task.state().config));
   setRequestsList(task.requests());
   setStrategy(task.strategy()->type);
 }
@@ -79,7 +83,7 @@ void MemoryTaskBuilder::currentRequestChanged(int index) {
     return;
   }
 
-  auto state = states[index];
+  auto state = replay.state(indexu + 1);
   auto request = _task.requests().at(indexu);
   updateTaskView(state, request);
 }
@@ -128,8 +132,10 @@ void MemoryTaskBuilder::processContextMenuAction(const QString &action,
     changed = true;
   }
 
-  _task = Utils::MemoryTask::create(
-      _task.strategy(), 0, MemoryState::initial(), requests);
+  _task = Utils::MemoryTask::create(_task.strategy(),
+                                    0,
+                                    MemoryState::initial(_task.state().config),
+                                    requests);
   loadTask(_task);
 
   if (changed) {
@@ -150,30 +156,34 @@ void MemoryTaskBuilder::processContextMenuAction(const QString &action,
 
 tl::optional<Request>
 MemoryTaskBuilder::processAddRequestMenuAction(const QString &action) {
+  const auto &config = _task.state().config;
+
   if (action == MemoryTaskAddRequestMenu::CREATE_PROCESS) {
-    auto info = AllocateMemoryDialog::getMemoryBlockInfo(this, 256);
+    auto info = AllocateMemoryDialog::getMemoryBlockInfo(this, config.pages());
 
     if (info) {
       auto [pid, pages] = *info;
-      return CreateProcessReq(pid, pages * 4096 - 1);
+      return CreateProcessReq(
+          pid, static_cast<int64_t>(pages) * config.pageSize(), config);
     }
   } else if (action == MemoryTaskAddRequestMenu::TERMINATE_PROCESS) {
     if (auto pid = PidInputDialog::getPid(this); pid.has_value()) {
       return TerminateProcessReq(pid.value());
     }
   } else if (action == MemoryTaskAddRequestMenu::ALLOCATE_MEMORY) {
-    auto info = AllocateMemoryDialog::getMemoryBlockInfo(this, 256);
+    auto info = AllocateMemoryDialog::getMemoryBlockInfo(this, config.pages());
 
     if (info) {
       auto [pid, pages] = *info;
-      return AllocateMemory(pid, pages * 4096 - 1);
+      return AllocateMemory(
+          pid, static_cast<int64_t>(pages) * config.pageSize(), config);
     }
   } else if (action == MemoryTaskAddRequestMenu::FREE_MEMORY) {
-    auto info = FreeMemoryDialog::getFreeMemoryInfo(this);
+    auto info = FreeMemoryDialog::getFreeMemoryInfo(this, config.pages());
 
     if (info) {
       auto [pid, address] = *info;
-      return FreeMemory(pid, address);
+      return FreeMemory(pid, address, config);
     }
   }
 
@@ -7,6 +7,7 @@
 
 #include <algo/memory/requests.h>
 #include <algo/memory/types.h>
+#include <utils/replay.h>
 #include <utils/tasks.h>
 
 #include "abstracttaskbuilder.h"
@@ -28,7 +29,7 @@ private:
 
   Utils::MemoryTask _task;
 
-  std::vector<MemoryManagement::MemoryState> states;
+  Utils::MemoryReplayCache replay;
 
   void loadTask(const Utils::MemoryTask &task);
 
@@ -28,13 +28,17 @@ static std::map<StrategyType, QString> strategyMap = {
     {StrategyType::SRT, "SRT"_qs},
     {StrategyType::WINDOWS, "Windows NT"_qs},
     {StrategyType::UNIX, "Unix"_qs},
-    {StrategyType::LINUXO1, "Linux O(1)"_qs}};
+    {StrategyType::LINUXO1, "Linux O(1)"_qs},
+    {StrategyType::CFS, "CFS"_qs}};
 
 ProcessesTaskBuilder::ProcessesTaskBuilder(const Utils::Task &task,
                                            QWidget *parent)
     : AbstractTaskBuilder(parent), HistoryNavigator(task),
-      _task(task.get<Utils::ProcessesTask>()), currentRequest(-1),
-      ui(new Ui::ProcessesTaskBuilder) {
+      _task(task.get<Utils::ProcessesTask>()),
+      replay(_task.strategy(),
+             _task.requests(),
+             ProcessesState::initial(_task.state().config)),
+      currentRequest(-1), ui(new Ui::ProcessesTaskBuilder) {
   ui->setupUi(this);
 
   auto font = QApplication::font();
@@ -65,20 +69,18 @@ ProcessesTaskBuilder::ProcessesTaskBuilder(const Utils::Task &task,
 ProcessesTaskBuilder::~ProcessesTaskBuilder() { delete ui; }
 
 void ProcessesTaskBuilder::loadTask(const Utils::ProcessesTask &task) {
-  auto state = ProcessesState::initial();
-
-  states.clear();
-  for (const auto &req : task.requests()) {
-    state = task.strategy()->processRequest(req, state);
-    states.push_back(state);
-  }
+  replay = Utils::ProcessesReplayCache(
+      task.strategy(),
+      task.requests(),
+      ProcessesState::initial(task.state().config));
   setRequestsList(task.requests());
   setStrategy(task.strategy()->type());
 }
 
 void ProcessesTaskBuilder::queuesListsChanged(int) {
-  auto state =
-      currentRequest == -1 ? ProcessesState::initial() : states[currentRequest];
+  auto state = currentRequest == -1
+                   ? ProcessesState::initial(_task.state().config)
+                   : replay.state(static_cast<size_t>(currentRequest) + 1);
   setQueuesLists(state.queues);
 }
 
@@ -89,7 +91,7 @@ void ProcessesTaskBuilder::currentRequestChanged(int index) {
     return;
   }
 
-  auto state = states[index];
+  auto state = replay.state(indexu + 1);
   auto request = _task.requests().at(indexu);
   updateTaskView(state, request);
 }
@@ -139,8 +141,8 @@ void ProcessesTaskBuilder::processContextMenuAction(const QString &action,
     changed = true;
   }
 
-  _task = Utils::ProcessesTask::create(
-      _task.strategy(), 0, ProcessesState::initial(), requests);
+  auto initial = ProcessesState::initial(_task.state().config);
+  _task = Utils::ProcessesTask::create(_task.strategy(), 0, initial, requests);
   loadTask(_task);
 
   if (changed) {
@@ -176,6 +178,7 @@ ProcessesTaskBuilder::processAddRequestMenuAction(const QString &action) {
             {StrategyType::SJN, {Field::Pid, Field::Ppid, Field::WorkTime}},
             {StrategyType::SRT, {Field::Pid, Field::Ppid, Field::WorkTime}},
             {StrategyType::UNIX, {Field::Pid, Field::Ppid, Field::Priority}},
+            {StrategyType::CFS, {Field::Pid, Field::Ppid, Field::Priority}},
             {StrategyType::WINDOWS,
              {Field::Pid, Field::Ppid, Field::Priority, Field::BasePriority}}}
             .at(_task.strategy()->type());
@@ -231,7 +234,7 @@ void ProcessesTaskBuilder::updateTaskView(const ProcessesState &state,
 }
 
 void ProcessesTaskBuilder::clearTaskView() {
-  auto state = ProcessesState::initial();
+  auto state = ProcessesState::initial(_task.state().config);
   setProcessesList(state.processes);
   setQueuesLists(state.queues);
   ui->labelRequestDescr->clear();
@@ -7,6 +7,7 @@
 
 #include <algo/processes/requests.h>
 #include <algo/processes/types.h>
+#include <utils/replay.h>
 #include <utils/tasks.h>
 
 #include "abstracttaskbuilder.h"
@@ -33,7 +34,7 @@ private:
 
   Utils::ProcessesTask _task;
 
-  std::vector<ProcessesManagement::ProcessesState> states;
+  Utils::ProcessesReplayCache replay;
 
   int currentRequest;
 
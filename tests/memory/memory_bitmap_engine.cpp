@@ -0,0 +1,330 @@
+#include <random>
+#include <vector>
+
+#include <catch2/catch.hpp>
+
+#include <algo/memory/bitmap_engine.h>
+#include <algo/memory/engine.h>
+#include <algo/memory/exceptions.h>
+#include <algo/memory/operations.h>
+#include <algo/memory/requests.h>
+#include <algo/memory/strategies.h>
+
+namespace mm = MemoryManagement;
+using std::vector;
+
+TEST_CASE("MemoryManagement::PageBitmap") {
+  mm::PageBitmap bitmap(200);
+
+  SECTION("Установка и сброс диапазона бит") {
+    bitmap.assign(3, 130, true);
+
+    REQUIRE(!bitmap.test(2));
+    REQUIRE(bitmap.test(3));
+    REQUIRE(bitmap.test(64));
+    REQUIRE(bitmap.test(129));
+    REQUIRE(!bitmap.test(130));
+
+    bitmap.assign(60, 70, false);
+    REQUIRE(bitmap.test(59));
+    REQUIRE(!bitmap.test(60));
+    REQUIRE(!bitmap.test(69));
+    REQUIRE(bitmap.test(70));
+  }
+
+  SECTION("Поиск установленных и сброшенных бит") {
+    bitmap.assign(0, 150, true);
+    bitmap.reset(70);
+
+    REQUIRE(bitmap.findReset(0) == 70);
+    REQUIRE(bitmap.findReset(71) == 150);
+    REQUIRE(bitmap.findSet(150) == 200);
+    REQUIRE(bitmap.findSet(70) == 71);
+    REQUIRE(bitmap.findSetBefore(150) == 149);
+    REQUIRE(bitmap.findSetBefore(71) == 69);
+    REQUIRE(bitmap.findSetBefore(0) == -1);
+
+    // биты за пределами карты не учитываются
+    bitmap.assign(150, 200, true);
+    REQUIRE(bitmap.findReset(71) == 200);
+  }
+}
+
+TEST_CASE("MemoryManagement::BitmapMemoryEngine") {
+  auto state = mm::MemoryState{{{0, 0, 12},   //
+                                {2, 12, 3},   //
+                                {-1, 15, 20}, //
+                                {2, 35, 1},   //
+                                {-1, 36, 7},  //
+                                {-1, 43, 13}, //
+                                {1, 56, 200}},
+                               {{-1, 43, 13}, //
+                                {-1, 15, 20}, //
+                                {-1, 36, 7}}};
+
+  SECTION("Создание состояния памяти") {
+    mm::BitmapMemoryEngine engine(state);
+
+    REQUIRE(engine.state() == state);
+    REQUIRE(!engine.compressed());
+    REQUIRE_THROWS_AS(
+        mm::BitmapMemoryEngine(mm::MemoryState{{{0, 0, 12}}, {}}),
+        mm::TypeException);
+  }
+
+  SECTION("Выделение памяти") {
+    mm::BitmapMemoryEngine engine(state);
+    engine.allocateMemory(*engine.findBlock(15), 3, 4);
+
+    REQUIRE(engine.state() == allocateMemory(state, 2, 3, 4));
+    REQUIRE_THROWS_AS(engine.allocateMemory(*engine.findBlock(12), 3, 1),
+                      mm::OperationException);
+    REQUIRE_THROWS_AS(engine.allocateMemory(*engine.findBlock(36), 3, 8),
+                      mm::OperationException);
+  }
+
+  SECTION("Освобождение памяти") {
+    mm::BitmapMemoryEngine engine(state);
+    engine.freeMemory(2, *engine.findBlock(12));
+
+    REQUIRE(engine.state() == freeMemory(state, 2, 1));
+    REQUIRE(engine.processBlocks(2) == vector<int32_t>{35});
+
+    engine.freeMemory(2, *engine.findBlock(35));
+    REQUIRE(!engine.hasProcess(2));
+    REQUIRE_THROWS_AS(engine.freeMemory(2, *engine.findBlock(0)),
+                      mm::OperationException);
+  }
+
+  SECTION("Сжатие памяти") {
+    mm::BitmapMemoryEngine engine(state);
+    engine.compressMemory(*engine.findBlock(36));
+
+    REQUIRE(engine.state() == compressMemory(state, 4));
+    REQUIRE_THROWS_AS(engine.compressMemory(*engine.findBlock(15)),
+                      mm::OperationException);
+  }
+
+  SECTION("Сжатие всей памяти") {
+    mm::BitmapMemoryEngine engine(state);
+    engine.sortFreeBlocks(mm::FreeBlocksOrder::ADDRESS);
+    engine.freeMemory(2, *engine.findBlock(35));
+    engine.compressAllMemory();
+
+    REQUIRE(engine.compressed());
+    REQUIRE(engine.state().blocks == vector<mm::MemoryBlock>{{0, 0, 12},
+                                                             {2, 12, 3},
+                                                             {-1, 15, 41},
+                                                             {1, 56, 200}});
+    REQUIRE(engine.state().freeBlocks ==
+            vector<mm::MemoryBlock>{{-1, 15, 41}});
+  }
+
+  SECTION("Освобождение памяти с объединением") {
+    mm::BitmapMemoryEngine engine(state);
+
+    // память не сжата, поэтому блок только освобождается
+    auto block = engine.releaseMemory(2, *engine.findBlock(35));
+    REQUIRE(block == 35);
+    REQUIRE(engine.state() == freeMemory(state, 2, 3));
+
+    engine.compressAllMemory();
+    block = engine.releaseMemory(2, *engine.findBlock(12));
+    REQUIRE(engine.compressed());
+    REQUIRE(block == 12);
+    REQUIRE(engine.state().blocks == vector<mm::MemoryBlock>{{0, 0, 12},
+                                                             {-1, 12, 44},
+                                                             {1, 56, 200}});
+
+    block = engine.releaseMemory(1, *engine.findBlock(56));
+    REQUIRE(block == 12);
+    REQUIRE(engine.state().freeBlocks ==
+            vector<mm::MemoryBlock>{{-1, 12, 244}});
+    REQUIRE(engine.totalFree() == 244);
+  }
+
+  SECTION("Дефрагментация памяти") {
+    mm::BitmapMemoryEngine engine(state);
+    engine.defragmentMemory();
+
+    REQUIRE(engine.state() == defragmentMemory(state));
+    REQUIRE(engine.findProcessBlock(1, 16) == 16);
+    REQUIRE(!engine.findProcessBlock(1, 56).has_value());
+    REQUIRE(engine.processBlocks(1) == vector<int32_t>{16});
+    REQUIRE(engine.processBlocks(2) == vector<int32_t>{12, 15});
+  }
+
+  SECTION("Уплотнение памяти") {
+    mm::BitmapMemoryEngine engine(state);
+    engine.compactMemory(21);
+
+    REQUIRE(engine.state() == defragmentMemory(state));
+    REQUIRE(engine.pagesMoved() == 201);
+  }
+
+  SECTION("Уплотнение памяти (минимальный сдвиг)") {
+    mm::BitmapMemoryEngine engine(state);
+    engine.setCompaction(mm::CompactionMode::MINIMAL);
+    engine.compactMemory(21);
+
+    REQUIRE(engine.state() == mm::MemoryState{{{0, 0, 12},   //
+                                               {2, 12, 3},   //
+                                               {2, 15, 1},   //
+                                               {-1, 16, 27}, //
+                                               {-1, 43, 13}, //
+                                               {1, 56, 200}},
+                                              {{-1, 43, 13}, //
+                                               {-1, 16, 27}}});
+    REQUIRE(engine.pagesMoved() == 1);
+    REQUIRE(engine.processBlocks(2) == vector<int32_t>{12, 15});
+  }
+
+  SECTION("Поиск блоков памяти") {
+    mm::BitmapMemoryEngine engine(state);
+
+    REQUIRE(engine.hasProcess(2));
+    REQUIRE(!engine.hasProcess(3));
+    REQUIRE(engine.processBlocks(2) == vector<int32_t>{12, 35});
+    REQUIRE(engine.processBlocks(3).empty());
+    REQUIRE(engine.findProcessBlock(2, 35) == 35);
+    REQUIRE(!engine.findProcessBlock(1, 35).has_value());
+    REQUIRE(engine.totalFree() == 40);
+    REQUIRE(engine.block(35) == mm::MemoryBlock{2, 35, 1});
+    REQUIRE(!engine.findBlock(34).has_value());
+
+    // до первой сортировки блоки перебираются в исходном порядке
+    REQUIRE(engine.findFreeBlock(10) == 43);
+    REQUIRE(!engine.findFreeBlock(21).has_value());
+  }
+
+  SECTION("Упорядочивание свободных блоков") {
+    mm::BitmapMemoryEngine engine(state);
+
+    engine.sortFreeBlocks(mm::FreeBlocksOrder::SIZE_ASCENDING);
+    REQUIRE(engine.state().freeBlocks == vector<mm::MemoryBlock>{{-1, 36, 7},
+                                                                 {-1, 43, 13},
+                                                                 {-1, 15, 20}});
+    REQUIRE(engine.findFreeBlock(8) == 43);
+
+    engine.sortFreeBlocks(mm::FreeBlocksOrder::SIZE_DESCENDING);
+    REQUIRE(engine.state().freeBlocks == vector<mm::MemoryBlock>{{-1, 15, 20},
+                                                                 {-1, 43, 13},
+                                                                 {-1, 36, 7}});
+    REQUIRE(engine.findFreeBlock(8) == 15);
+    REQUIRE(!engine.findFreeBlock(21).has_value());
+
+    engine.sortFreeBlocks(mm::FreeBlocksOrder::ADDRESS);
+    REQUIRE(engine.findFreeBlock(8) == 15);
+    REQUIRE(engine.findFreeBlock(13) == 15);
+    REQUIRE(engine.findFreeBlock(1) == 15);
+
+    engine.sortFreeBlocks(mm::FreeBlocksOrder::SEGREGATED);
+    REQUIRE(engine.state().freeBlocks == vector<mm::MemoryBlock>{{-1, 36, 7},
+                                                                 {-1, 43, 13},
+                                                                 {-1, 15, 20}});
+    REQUIRE(engine.findFreeBlock(8) == 43);
+  }
+
+  SECTION("Поиск свободных блоков по кругу") {
+    auto rotated = mm::MemoryState{state.blocks,
+                                   {{-1, 43, 13}, //
+                                    {-1, 15, 20}, //
+                                    {-1, 36, 7}}};
+    mm::BitmapMemoryEngine engine(rotated);
+    engine.sortFreeBlocks(mm::FreeBlocksOrder::ROVING);
+    REQUIRE(engine.state() == rotated);
+    REQUIRE(engine.findFreeBlock(8) == 43);
+
+    engine.allocateMemory(43, 3, 8);
+    REQUIRE(engine.state().freeBlocks == vector<mm::MemoryBlock>{{-1, 51, 5},
+                                                                 {-1, 15, 20},
+                                                                 {-1, 36, 7}});
+    REQUIRE(engine.findFreeBlock(6) == 15);
+
+    engine.allocateMemory(15, 3, 6);
+    engine.freeMemory(2, 12);
+    REQUIRE(engine.state().freeBlocks == vector<mm::MemoryBlock>{{-1, 21, 14},
+                                                                 {-1, 36, 7},
+                                                                 {-1, 51, 5},
+                                                                 {-1, 12, 3}});
+    REQUIRE(!engine.findFreeBlock(15).has_value());
+  }
+
+  SECTION("Деление и объединение свободных блоков") {
+    mm::BitmapMemoryEngine engine(state);
+    engine.sortFreeBlocks(mm::FreeBlocksOrder::ADDRESS);
+
+    auto second = engine.splitFreeBlock(*engine.findBlock(15), 5);
+    REQUIRE(second == 20);
+    REQUIRE(engine.block(15) == mm::MemoryBlock{-1, 15, 5});
+    REQUIRE(engine.block(20) == mm::MemoryBlock{-1, 20, 15});
+    REQUIRE(engine.previousBlock(20) == 15);
+    REQUIRE(engine.nextBlock(20) == 35);
+    REQUIRE(!engine.previousBlock(0).has_value());
+    REQUIRE(!engine.nextBlock(56).has_value());
+    REQUIRE_THROWS_AS(engine.splitFreeBlock(15, 5), mm::OperationException);
+    REQUIRE_THROWS_AS(engine.splitFreeBlock(12, 1), mm::OperationException);
+
+    engine.mergeFreeBlocks(15);
+    REQUIRE(engine.state() == mm::MemoryState{state.blocks,
+                                              {{-1, 15, 20}, //
+                                               {-1, 36, 7},  //
+                                               {-1, 43, 13}}});
+    REQUIRE_THROWS_AS(engine.mergeFreeBlocks(15), mm::OperationException);
+  }
+}
+
+TEST_CASE("MemoryManagement::AbstractStrategy::processRequest (битовая "
+          "карта)") {
+  const mm::MemoryConfig config{1000, 4096};
+
+  vector<mm::StrategyPtr> strategies = {
+      mm::FirstAppropriateStrategy::create(),
+      mm::MostAppropriateStrategy::create(),
+      mm::LeastAppropriateStrategy::create(),
+      mm::BuddyStrategy::create(),
+      mm::TlsfStrategy::create(),
+      mm::NextAppropriateStrategy::create()};
+
+  for (const auto &strategy : strategies) {
+    for (auto mode : {mm::CompactionMode::FULL, mm::CompactionMode::MINIMAL}) {
+      std::mt19937 random(2020);
+      std::uniform_int_distribution<int32_t> pids(0, 15), pages(1, 64),
+          types(0, 9);
+
+      mm::MemoryEngine engine(mm::MemoryState::initial(config));
+      mm::BitmapMemoryEngine bitmap(mm::MemoryState::initial(config));
+      engine.setCompaction(mode);
+      bitmap.setCompaction(mode);
+
+      for (int i = 0; i < 2000; ++i) {
+        auto pid = pids(random);
+        auto bytes = static_cast<int64_t>(pages(random)) * config.pageSize();
+        auto type = types(random);
+
+        mm::Request request = mm::TerminateProcessReq(pid);
+        if (!engine.hasProcess(pid)) {
+          request = mm::CreateProcessReq(pid, bytes, config);
+        } else if (type < 5) {
+          request = mm::AllocateMemory(pid, bytes, config);
+        } else if (type < 9) {
+          auto blocks = engine.processBlocks(pid);
+          auto address = blocks[random() % blocks.size()]->address();
+          request = mm::FreeMemory(pid, address, config);
+        }
+
+        strategy->processRequest(request, engine);
+        strategy->processRequest(request, bitmap);
+
+        REQUIRE(bitmap.state() == engine.state());
+
+        vector<int32_t> addresses;
+        for (auto block : engine.processBlocks(pid)) {
+          addresses.push_back(block->address());
+        }
+        REQUIRE(bitmap.processBlocks(pid) == addresses);
+      }
+      REQUIRE(bitmap.pagesMoved() == engine.pagesMoved());
+    }
+  }
+}
@@ -0,0 +1,314 @@
+#include <vector>
+
+#include <catch2/catch.hpp>
+
+#include <algo/memory/engine.h>
+#include <algo/memory/exceptions.h>
+#include <algo/memory/operations.h>
+#include <algo/memory/requests.h>
+#include <algo/memory/strategies.h>
+
+namespace mm = MemoryManagement;
+using std::vector;
+
+static int32_t address(mm::MemoryEngine::BlockHandle block) {
+  return block->address();
+}
+
+TEST_CASE("MemoryManagement::MemoryEngine") {
+  auto state = mm::MemoryState{{{0, 0, 12},   //
+                                {2, 12, 3},   //
+                                {-1, 15, 20}, //
+                                {2, 35, 1},   //
+                                {-1, 36, 7},  //
+                                {-1, 43, 13}, //
+                                {1, 56, 200}},
+                               {{-1, 15, 20}, //
+                                {-1, 36, 7},  //
+                                {-1, 43, 13}}};
+
+  SECTION("Выделение памяти") {
+    mm::MemoryEngine engine(state);
+    engine.allocateMemory(*engine.findBlock(15), 3, 4);
+
+    REQUIRE(engine.state() == allocateMemory(state, 2, 3, 4));
+    REQUIRE_THROWS_AS(engine.allocateMemory(*engine.findBlock(12), 3, 1),
+                      mm::OperationException);
+    REQUIRE_THROWS_AS(engine.allocateMemory(*engine.findBlock(36), 3, 8),
+                      mm::OperationException);
+  }
+
+  SECTION("Освобождение памяти") {
+    mm::MemoryEngine engine(state);
+    engine.freeMemory(2, *engine.findBlock(12));
+
+    REQUIRE(engine.state() == freeMemory(state, 2, 1));
+    REQUIRE(engine.processBlocks(2).size() == 1);
+
+    engine.freeMemory(2, *engine.findBlock(35));
+    REQUIRE(!engine.hasProcess(2));
+    REQUIRE_THROWS_AS(engine.freeMemory(2, *engine.findBlock(0)),
+                      mm::OperationException);
+  }
+
+  SECTION("Сжатие памяти") {
+    mm::MemoryEngine engine(state);
+    engine.compressMemory(*engine.findBlock(36));
+
+    REQUIRE(engine.state() == compressMemory(state, 4));
+    REQUIRE_THROWS_AS(engine.compressMemory(*engine.findBlock(15)),
+                      mm::OperationException);
+  }
+
+  SECTION("Сжатие всей памяти") {
+    mm::MemoryEngine engine(state);
+    REQUIRE(!engine.compressed());
+
+    engine.freeMemory(2, *engine.findBlock(35));
+    engine.compressAllMemory();
+
+    REQUIRE(engine.compressed());
+    REQUIRE(engine.state().blocks == vector<mm::MemoryBlock>{{0, 0, 12},
+                                                             {2, 12, 3},
+                                                             {-1, 15, 41},
+                                                             {1, 56, 200}});
+    REQUIRE(engine.state().freeBlocks ==
+            vector<mm::MemoryBlock>{{-1, 15, 41}});
+  }
+
+  SECTION("Освобождение памяти с объединением") {
+    mm::MemoryEngine engine(state);
+
+    // память не сжата, поэтому блок только освобождается
+    auto block = engine.releaseMemory(2, *engine.findBlock(35));
+    REQUIRE(block->address() == 35);
+    REQUIRE(engine.state() == freeMemory(state, 2, 3));
+
+    engine.compressAllMemory();
+    block = engine.releaseMemory(2, *engine.findBlock(12));
+    REQUIRE(engine.compressed());
+    REQUIRE(block->address() == 12);
+    REQUIRE(engine.state().blocks == vector<mm::MemoryBlock>{{0, 0, 12},
+                                                             {-1, 12, 44},
+                                                             {1, 56, 200}});
+    REQUIRE(engine.state().freeBlocks ==
+            vector<mm::MemoryBlock>{{-1, 12, 44}});
+
+    block = engine.releaseMemory(1, *engine.findBlock(56));
+    REQUIRE(block->address() == 12);
+    REQUIRE(engine.state().freeBlocks ==
+            vector<mm::MemoryBlock>{{-1, 12, 244}});
+    REQUIRE_THROWS_AS(engine.releaseMemory(1, *engine.findBlock(0)),
+                      mm::OperationException);
+  }
+
+  SECTION("Дефрагментация памяти") {
+    mm::MemoryEngine engine(state);
+    engine.defragmentMemory();
+
+    REQUIRE(engine.state() == defragmentMemory(state));
+    REQUIRE(engine.findProcessBlock(1, 16).map(address) == 16);
+    REQUIRE(!engine.findProcessBlock(1, 56).has_value());
+  }
+
+  SECTION("Уплотнение памяти") {
+    mm::MemoryEngine engine(state);
+    REQUIRE(engine.compaction() == mm::CompactionMode::FULL);
+    engine.compactMemory(21);
+
+    REQUIRE(engine.state() == defragmentMemory(state));
+    REQUIRE(engine.pagesMoved() == 201);
+  }
+
+  SECTION("Уплотнение памяти (минимальный сдвиг)") {
+    mm::MemoryEngine engine(state);
+    engine.setCompaction(mm::CompactionMode::MINIMAL);
+    engine.compactMemory(21);
+
+    // сдвигается только блок между двумя первыми свободными блоками
+    REQUIRE(engine.state() == mm::MemoryState{{{0, 0, 12},   //
+                                               {2, 12, 3},   //
+                                               {2, 15, 1},   //
+                                               {-1, 16, 27}, //
+                                               {-1, 43, 13}, //
+                                               {1, 56, 200}},
+                                              {{-1, 43, 13}, //
+                                               {-1, 16, 27}}});
+    REQUIRE(engine.pagesMoved() == 1);
+    REQUIRE(engine.processBlocks(2).back()->address() == 15);
+
+    // стратегии уплотняют память тем же способом
+    mm::MemoryEngine copy(state);
+    copy.setCompaction(mm::CompactionMode::MINIMAL);
+    auto strategy = mm::FirstAppropriateStrategy::create();
+    strategy->processRequest(mm::AllocateMemory(1, 21 * 4096), copy);
+    REQUIRE(copy.state().blocks == vector<mm::MemoryBlock>{{0, 0, 12},   //
+                                                           {2, 12, 3},   //
+                                                           {2, 15, 1},   //
+                                                           {1, 16, 21},  //
+                                                           {-1, 37, 6},  //
+                                                           {-1, 43, 13}, //
+                                                           {1, 56, 200}});
+    REQUIRE(copy.pagesMoved() == 1);
+  }
+
+  SECTION("Поиск блоков памяти") {
+    mm::MemoryEngine engine(state);
+
+    REQUIRE(engine.hasProcess(2));
+    REQUIRE(!engine.hasProcess(3));
+    REQUIRE(engine.processBlocks(2).size() == 2);
+    REQUIRE(engine.processBlocks(2)[1]->address() == 35);
+    REQUIRE(engine.processBlocks(3).empty());
+    REQUIRE(engine.findProcessBlock(2, 35).map(address) == 35);
+    REQUIRE(!engine.findProcessBlock(1, 35).has_value());
+    REQUIRE(!engine.findProcessBlock(3, 35).has_value());
+    REQUIRE(engine.totalFree() == 40);
+    REQUIRE(engine.findBlock(35).map(address) == 35);
+    REQUIRE(!engine.findBlock(34).has_value());
+    REQUIRE(engine.findFreeBlock(10).map(address) == 15);
+    REQUIRE(!engine.findFreeBlock(21).has_value());
+  }
+
+  SECTION("Копирование состояния") {
+    mm::MemoryEngine engine(state);
+    engine.sortFreeBlocks(mm::FreeBlocksOrder::SIZE_ASCENDING);
+
+    auto copy = engine;
+    copy.allocateMemory(*copy.findFreeBlock(8), 3, 8);
+
+    REQUIRE(engine.state().freeBlocks == vector<mm::MemoryBlock>{{-1, 36, 7},
+                                                                 {-1, 43, 13},
+                                                                 {-1, 15, 20}});
+    REQUIRE(copy.order() == mm::FreeBlocksOrder::SIZE_ASCENDING);
+    REQUIRE(copy.state().freeBlocks == vector<mm::MemoryBlock>{{-1, 51, 5},
+                                                               {-1, 36, 7},
+                                                               {-1, 15, 20}});
+    REQUIRE(copy.hasProcess(3));
+    REQUIRE(!engine.hasProcess(3));
+  }
+
+  SECTION("Упорядочивание свободных блоков") {
+    mm::MemoryEngine engine(state);
+
+    engine.sortFreeBlocks(mm::FreeBlocksOrder::SIZE_ASCENDING);
+    REQUIRE(engine.state().freeBlocks == vector<mm::MemoryBlock>{{-1, 36, 7},
+                                                                 {-1, 43, 13},
+                                                                 {-1, 15, 20}});
+    REQUIRE(engine.findFreeBlock(8).map(address) == 43);
+
+    engine.sortFreeBlocks(mm::FreeBlocksOrder::SIZE_DESCENDING);
+    REQUIRE(engine.state().freeBlocks == vector<mm::MemoryBlock>{{-1, 15, 20},
+                                                                 {-1, 43, 13},
+                                                                 {-1, 36, 7}});
+    REQUIRE(engine.findFreeBlock(8).map(address) == 15);
+    REQUIRE(!engine.findFreeBlock(21).has_value());
+
+    // порядок сохраняется при изменении состояния
+    engine.allocateMemory(*engine.findBlock(15), 3, 10);
+    REQUIRE(engine.state().freeBlocks == vector<mm::MemoryBlock>{{-1, 43, 13},
+                                                                 {-1, 25, 10},
+                                                                 {-1, 36, 7}});
+
+    engine.sortFreeBlocks(mm::FreeBlocksOrder::ADDRESS);
+    engine.freeMemory(0, *engine.findBlock(0));
+    REQUIRE(engine.state().freeBlocks == vector<mm::MemoryBlock>{{-1, 0, 12},
+                                                                 {-1, 25, 10},
+                                                                 {-1, 36, 7},
+                                                                 {-1, 43, 13}});
+    REQUIRE(engine.findFreeBlock(13).map(address) == 43);
+
+    engine.sortFreeBlocks(mm::FreeBlocksOrder::SEGREGATED);
+    REQUIRE(engine.state().freeBlocks == vector<mm::MemoryBlock>{{-1, 36, 7},
+                                                                 {-1, 25, 10},
+                                                                 {-1, 0, 12},
+                                                                 {-1, 43, 13}});
+    REQUIRE(engine.findFreeBlock(11).map(address) == 0);
+    REQUIRE(engine.findFreeBlock(13).map(address) == 43);
+  }
+
+  SECTION("Поиск свободных блоков по кругу") {
+    auto rotated = mm::MemoryState{state.blocks,
+                                   {{-1, 43, 13}, //
+                                    {-1, 15, 20}, //
+                                    {-1, 36, 7}}};
+    mm::MemoryEngine engine(rotated);
+    engine.sortFreeBlocks(mm::FreeBlocksOrder::ROVING);
+    REQUIRE(engine.state() == rotated);
+    REQUIRE(engine.findFreeBlock(8).map(address) == 43);
+
+    // поиск продолжается с остатка блока, в котором была выделена память
+    engine.allocateMemory(*engine.findBlock(43), 3, 8);
+    REQUIRE(engine.state().freeBlocks == vector<mm::MemoryBlock>{{-1, 51, 5},
+                                                                 {-1, 15, 20},
+                                                                 {-1, 36, 7}});
+    REQUIRE(engine.findFreeBlock(6).map(address) == 15);
+
+    engine.allocateMemory(*engine.findBlock(15), 3, 6);
+    engine.freeMemory(2, *engine.findBlock(12));
+    REQUIRE(engine.state().freeBlocks == vector<mm::MemoryBlock>{{-1, 21, 14},
+                                                                 {-1, 36, 7},
+                                                                 {-1, 51, 5},
+                                                                 {-1, 12, 3}});
+    REQUIRE(!engine.findFreeBlock(15).has_value());
+
+    // копия продолжает поиск с того же блока
+    auto copy = engine;
+    REQUIRE(copy.state() == engine.state());
+  }
+
+  SECTION("Деление и объединение свободных блоков") {
+    mm::MemoryEngine engine(state);
+    engine.sortFreeBlocks(mm::FreeBlocksOrder::ADDRESS);
+
+    auto block = *engine.findBlock(15);
+    auto second = engine.splitFreeBlock(block, 5);
+    REQUIRE(engine.block(block) == mm::MemoryBlock{-1, 15, 5});
+    REQUIRE(engine.block(second) == mm::MemoryBlock{-1, 20, 15});
+    REQUIRE(engine.previousBlock(second).map(address) == 15);
+    REQUIRE(engine.nextBlock(second).map(address) == 35);
+    REQUIRE(!engine.previousBlock(*engine.findBlock(0)).has_value());
+    REQUIRE(!engine.nextBlock(*engine.findBlock(56)).has_value());
+    REQUIRE_THROWS_AS(engine.splitFreeBlock(block, 5), mm::OperationException);
+    REQUIRE_THROWS_AS(engine.splitFreeBlock(*engine.findBlock(12), 1),
+                      mm::OperationException);
+
+    engine.mergeFreeBlocks(block);
+    REQUIRE(engine.state() == mm::MemoryState{state.blocks,
+                                              {{-1, 15, 20}, //
+                                               {-1, 36, 7},  //
+                                               {-1, 43, 13}}});
+    REQUIRE_THROWS_AS(engine.mergeFreeBlocks(block), mm::OperationException);
+  }
+}
+
+TEST_CASE("MemoryManagement::AbstractStrategy::processRequest (на месте)") {
+  vector<mm::Request> requests = {mm::CreateProcessReq(0, 40 * 4096),
+                                  mm::CreateProcessReq(1, 30 * 4096),
+                                  mm::AllocateMemory(0, 10 * 4096),
+                                  mm::CreateProcessReq(2, 60 * 4096),
+                                  mm::FreeMemory(0, 0),
+                                  mm::AllocateMemory(1, 5 * 4096),
+                                  mm::TerminateProcessReq(2),
+                                  mm::CreateProcessReq(3, 150 * 4096),
+                                  mm::AllocateMemory(3, 20 * 4096),
+                                  mm::FreeMemory(1, 40),
+                                  mm::TerminateProcessReq(0)};
+
+  vector<mm::StrategyPtr> strategies = {
+      mm::FirstAppropriateStrategy::create(),
+      mm::MostAppropriateStrategy::create(),
+      mm::LeastAppropriateStrategy::create()};
+
+  for (const auto &strategy : strategies) {
+    auto state = mm::MemoryState::initial();
+    mm::MemoryEngine engine(state);
+
+    for (const auto &request : requests) {
+      state = strategy->processRequest(request, state);
+      strategy->processRequest(request, engine);
+
+      REQUIRE(engine.state() == state);
+    }
+  }
+}
@@ -36,6 +36,16 @@ TEST_CASE("MemoryManagement::CreateProcessReq") {
     REQUIRE_THROWS_AS(mm::CreateProcessReq(0, 257 * 4096),
                       mm::RequestException);
   }
+
+  SECTION("Ограничения на параметры CreateProcessReq (размер памяти)") {
+    mm::MemoryConfig config{1 << 20, 4096};
+    auto request = mm::CreateProcessReq(0, int64_t(1) << 32, config);
+
+    REQUIRE(request.bytes() == int64_t(1) << 32);
+    REQUIRE(request.pages(config) == 1 << 20);
+    REQUIRE_THROWS_AS(mm::CreateProcessReq(0, (int64_t(1) << 32) + 1, config),
+                      mm::RequestException);
+  }
 }
 
 TEST_CASE("MemoryManagement::TerminateProcessReq") {
@@ -91,6 +101,15 @@ TEST_CASE("MemoryManagement::AllocateMemory") {
     REQUIRE_THROWS_AS(mm::AllocateMemory(0, -1), mm::RequestException);
     REQUIRE_THROWS_AS(mm::AllocateMemory(0, 257 * 4096), mm::RequestException);
   }
+
+  SECTION("Ограничения на параметры AllocateMemory (размер памяти)") {
+    mm::MemoryConfig config{16, 512};
+    auto request = mm::AllocateMemory(0, 513, config);
+
+    REQUIRE(request.pages(config) == 2);
+    REQUIRE_THROWS_AS(mm::AllocateMemory(0, 16 * 512 + 1, config),
+                      mm::RequestException);
+  }
 }
 
 TEST_CASE("MemoryManagement::FreeMemory") {
@@ -121,4 +140,11 @@ TEST_CASE("MemoryManagement::FreeMemory") {
     REQUIRE_THROWS_AS(mm::FreeMemory(0, -1), mm::RequestException);
     REQUIRE_THROWS_AS(mm::FreeMemory(0, 256), mm::RequestException);
   }
+
+  SECTION("Ограничения на параметры FreeMemory (размер памяти)") {
+    mm::MemoryConfig config{1024, 4096};
+
+    REQUIRE(mm::FreeMemory(0, 1023, config).address() == 1023);
+    REQUIRE_THROWS_AS(mm::FreeMemory(0, 1024, config), mm::RequestException);
+  }
 }
@@ -1,3 +1,6 @@
+#include <cstddef>
+#include <vector>
+
 #include <catch2/catch.hpp>
 
 #include <algo/memory/requests.h>
@@ -861,3 +864,534 @@ TEST_CASE("MemoryManagement::LeastAppropriateStrategy") {
     REQUIRE(actual == expected);
   }
 }
+
+TEST_CASE("MemoryManagement::AbstractStrategy (размер памяти)") {
+  mm::MemoryConfig config{1024, 512};
+  auto pages = config.pages();
+
+  SECTION("Обработать заявки CreateProcessReq и AllocateMemory") {
+    auto strategy = mm::FirstAppropriateStrategy::create();
+    auto state = mm::MemoryState::initial(config);
+
+    state = strategy->processRequest(mm::CreateProcessReq(0, 513, config),
+                                     state);
+    state = strategy->processRequest(
+        mm::AllocateMemory(0, 1000 * 512, config), state);
+
+    auto expected = mm::MemoryState{{{0, 0, 2, pages},    //
+                                     {0, 2, 1000, pages}, //
+                                     {-1, 1002, 22, pages}},
+                                    {{-1, 1002, 22, pages}},
+                                    config};
+    REQUIRE(state == expected);
+
+    // недостаточно памяти
+    auto actual = strategy->processRequest(
+        mm::AllocateMemory(0, 23 * 512, config), state);
+    REQUIRE(actual == expected);
+  }
+
+  SECTION("Обработать заявку TerminateProcessReq") {
+    auto strategy = mm::MostAppropriateStrategy::create();
+    auto state = mm::MemoryState{{{0, 0, 2, pages},    //
+                                  {1, 2, 1000, pages}, //
+                                  {-1, 1002, 22, pages}},
+                                 {{-1, 1002, 22, pages}},
+                                 config};
+
+    auto expected = mm::MemoryState{{{0, 0, 2, pages}, //
+                                     {-1, 2, 1022, pages}},
+                                    {{-1, 2, 1022, pages}},
+                                    config};
+    auto actual = strategy->processRequest(mm::TerminateProcessReq(1), state);
+    REQUIRE(actual == expected);
+  }
+}
+
+TEST_CASE("MemoryManagement::AbstractStrategy::processRequests") {
+  std::vector<mm::StrategyPtr> strategies = {
+      mm::FirstAppropriateStrategy::create(),
+      mm::MostAppropriateStrategy::create(),
+      mm::LeastAppropriateStrategy::create(),
+      mm::BuddyStrategy::create(),
+      mm::TlsfStrategy::create(),
+      mm::NextAppropriateStrategy::create()};
+  std::vector<mm::Request> requests = {mm::CreateProcessReq(0, 4 * 4096),
+                                       mm::CreateProcessReq(1, 3 * 4096),
+                                       mm::AllocateMemory(0, 2 * 4096),
+                                       mm::CreateProcessReq(2, 1),
+                                       mm::FreeMemory(0, 0),
+                                       mm::AllocateMemory(2, 5 * 4096),
+                                       mm::TerminateProcessReq(1),
+                                       mm::AllocateMemory(0, 200 * 4096)};
+
+  for (const auto &strategy : strategies) {
+    SECTION("Обработать последовательность заявок (" + strategy->toString() +
+            ")") {
+      auto state = mm::MemoryState::initial();
+      std::vector<mm::MemoryState> expected;
+      for (const auto &request : requests) {
+        state = strategy->processRequest(request, state);
+        expected.push_back(state);
+      }
+
+      std::vector<mm::MemoryState> snapshots;
+      std::vector<std::size_t> indices;
+      auto actual = strategy->processRequests(
+          requests.begin(),
+          requests.end(),
+          mm::MemoryState::initial(),
+          [&](std::size_t index, const mm::MemoryEngine &engine) {
+            indices.push_back(index);
+            snapshots.push_back(engine.state());
+          });
+
+      REQUIRE(actual == state);
+      REQUIRE(snapshots == expected);
+      REQUIRE(indices == std::vector<std::size_t>{0, 1, 2, 3, 4, 5, 6, 7});
+
+      REQUIRE(strategy->processRequests(requests.begin(),
+                                        requests.begin() + 3,
+                                        mm::MemoryState::initial()) ==
+              expected[2]);
+    }
+  }
+}
+
+TEST_CASE("MemoryManagement::BuddyStrategy") {
+  SECTION("Создать экземпляр BuddyStrategy") {
+    auto strategy = mm::BuddyStrategy::create();
+
+    REQUIRE(strategy->type == mm::StrategyType::BUDDY);
+    REQUIRE(mm::BuddyStrategy::blockSize(1) == 1);
+    REQUIRE(mm::BuddyStrategy::blockSize(5) == 8);
+    REQUIRE(mm::BuddyStrategy::blockSize(64) == 64);
+  }
+
+  SECTION("Обработать заявку CreateProcessReq") {
+    auto strategy = mm::BuddyStrategy::create();
+    auto request = mm::CreateProcessReq(0, 5 * 4096);
+
+    auto state = mm::MemoryState::initial();
+
+    auto expected = mm::MemoryState{{{0, 0, 8}, //<- блок размера 2^3
+                                     {-1, 8, 8},   //
+                                     {-1, 16, 16}, //
+                                     {-1, 32, 32}, //
+                                     {-1, 64, 64}, //
+                                     {-1, 128, 128}},
+                                    {{-1, 8, 8},   //
+                                     {-1, 16, 16}, //
+                                     {-1, 32, 32}, //
+                                     {-1, 64, 64}, //
+                                     {-1, 128, 128}}};
+    auto actual = strategy->processRequest(request, state);
+    REQUIRE(actual == expected);
+  }
+
+  SECTION("Обработать заявку CreateProcessReq (недостаточно памяти)") {
+    auto strategy = mm::BuddyStrategy::create();
+    auto request = mm::CreateProcessReq(3, 40 * 4096);
+
+    // суммарно свободной памяти достаточно, но дефрагментация не выполняется
+    auto state = mm::MemoryState{{{0, 0, 128},   //
+                                  {-1, 128, 32}, //
+                                  {1, 160, 32},  //
+                                  {-1, 192, 32}, //
+                                  {2, 224, 32}},
+                                 {{-1, 128, 32}, //
+                                  {-1, 192, 32}}};
+
+    auto expected = state;
+    auto actual = strategy->processRequest(request, state);
+    REQUIRE(actual == expected);
+  }
+
+  SECTION("Обработать заявку CreateProcessReq (процесс уже создан)") {
+    auto strategy = mm::BuddyStrategy::create();
+    auto request = mm::CreateProcessReq(0, 4096);
+
+    auto state = mm::MemoryState{{{0, 0, 128}, //
+                                  {-1, 128, 128}},
+                                 {{-1, 128, 128}}};
+
+    auto expected = state;
+    auto actual = strategy->processRequest(request, state);
+    REQUIRE(actual == expected);
+  }
+
+  SECTION("Обработать заявку CreateProcessReq (размер памяти)") {
+    auto strategy = mm::BuddyStrategy::create();
+    mm::MemoryConfig config{12, 4096};
+    auto request = mm::CreateProcessReq(0, 4 * 4096, config);
+
+    // исходный блок делится на блоки системы двойников размером 8 и 4
+    auto state = mm::MemoryState::initial(config);
+
+    auto expected = mm::MemoryState{{{-1, 0, 8, 12}, //
+                                     {0, 8, 4, 12}},
+                                    {{-1, 0, 8, 12}},
+                                    config};
+    auto actual = strategy->processRequest(request, state);
+    REQUIRE(actual == expected);
+  }
+
+  SECTION("Обработать заявку TerminateProcessReq") {
+    auto strategy = mm::BuddyStrategy::create();
+    auto request = mm::TerminateProcessReq(1);
+
+    auto state = mm::MemoryState{{{-1, 0, 16}, //
+                                  {1, 16, 16}, //<- освобождаемый блок
+                                  {-1, 32, 32}, //
+                                  {-1, 64, 64}, //
+                                  {-1, 128, 128}},
+                                 {{-1, 0, 16},  //
+                                  {-1, 32, 32}, //
+                                  {-1, 64, 64}, //
+                                  {-1, 128, 128}}};
+
+    // блок последовательно объединяется со всеми двойниками
+    auto expected = mm::MemoryState::initial();
+    auto actual = strategy->processRequest(request, state);
+    REQUIRE(actual == expected);
+  }
+
+  SECTION("Обработать заявку AllocateMemory") {
+    auto strategy = mm::BuddyStrategy::create();
+    auto request = mm::AllocateMemory(0, 3 * 4096);
+
+    auto state = mm::MemoryState{{{0, 0, 8},
+                                  {-1, 8, 8}, //<- блок, который будет разделен
+                                  {-1, 16, 16}, //
+                                  {-1, 32, 32}, //
+                                  {-1, 64, 64}, //
+                                  {-1, 128, 128}},
+                                 {{-1, 8, 8},   //
+                                  {-1, 16, 16}, //
+                                  {-1, 32, 32}, //
+                                  {-1, 64, 64}, //
+                                  {-1, 128, 128}}};
+
+    auto expected = mm::MemoryState{{{0, 0, 8},     //
+                                     {0, 8, 4},     //
+                                     {-1, 12, 4},   //
+                                     {-1, 16, 16},  //
+                                     {-1, 32, 32},  //
+                                     {-1, 64, 64},  //
+                                     {-1, 128, 128}},
+                                    {{-1, 12, 4},  //
+                                     {-1, 16, 16}, //
+                                     {-1, 32, 32}, //
+                                     {-1, 64, 64}, //
+                                     {-1, 128, 128}}};
+    auto actual = strategy->processRequest(request, state);
+    REQUIRE(actual == expected);
+  }
+
+  SECTION("Обработать заявку AllocateMemory (процесс не существует)") {
+    auto strategy = mm::BuddyStrategy::create();
+    auto request = mm::AllocateMemory(1, 4096);
+
+    auto state = mm::MemoryState{{{0, 0, 128}, //
+                                  {-1, 128, 128}},
+                                 {{-1, 128, 128}}};
+
+    auto expected = state;
+    auto actual = strategy->processRequest(request, state);
+    REQUIRE(actual == expected);
+  }
+
+  SECTION("Обработать заявку FreeMemory") {
+    auto strategy = mm::BuddyStrategy::create();
+    auto request = mm::FreeMemory(0, 0);
+
+    auto state = mm::MemoryState{{{0, 0, 8}, //<- освобождаемый блок
+                                  {-1, 8, 8},   //
+                                  {0, 16, 16},  //
+                                  {-1, 32, 32}, //
+                                  {-1, 64, 64}, //
+                                  {-1, 128, 128}},
+                                 {{-1, 8, 8},   //
+                                  {-1, 32, 32}, //
+                                  {-1, 64, 64}, //
+                                  {-1, 128, 128}}};
+
+    auto expected = mm::MemoryState{{{-1, 0, 16},  //
+                                     {0, 16, 16},  //
+                                     {-1, 32, 32}, //
+                                     {-1, 64, 64}, //
+                                     {-1, 128, 128}},
+                                    {{-1, 0, 16},  //
+                                     {-1, 32, 32}, //
+                                     {-1, 64, 64}, //
+                                     {-1, 128, 128}}};
+    auto actual = strategy->processRequest(request, state);
+    REQUIRE(actual == expected);
+  }
+
+  SECTION("Обработать заявку FreeMemory (двойник разделен)") {
+    auto strategy = mm::BuddyStrategy::create();
+    auto request = mm::FreeMemory(0, 0);
+
+    auto state = mm::MemoryState{{{0, 0, 8},   //
+                                  {-1, 8, 4},  //
+                                  {1, 12, 4},  //
+                                  {-1, 16, 16}, //
+                                  {-1, 32, 32}, //
+                                  {-1, 64, 64}, //
+                                  {-1, 128, 128}},
+                                 {{-1, 8, 4},   //
+                                  {-1, 16, 16}, //
+                                  {-1, 32, 32}, //
+                                  {-1, 64, 64}, //
+                                  {-1, 128, 128}}};
+
+    auto expected = mm::MemoryState{{{-1, 0, 8},   //
+                                     {-1, 8, 4},   //
+                                     {1, 12, 4},   //
+                                     {-1, 16, 16}, //
+                                     {-1, 32, 32}, //
+                                     {-1, 64, 64}, //
+                                     {-1, 128, 128}},
+                                    {{-1, 8, 4},   //
+                                     {-1, 0, 8},   //
+                                     {-1, 16, 16}, //
+                                     {-1, 32, 32}, //
+                                     {-1, 64, 64}, //
+                                     {-1, 128, 128}}};
+    auto actual = strategy->processRequest(request, state);
+    REQUIRE(actual == expected);
+  }
+
+  SECTION("Обработать заявку FreeMemory (блок принадлежит другому процессу)") {
+    auto strategy = mm::BuddyStrategy::create();
+    auto request = mm::FreeMemory(1, 0);
+
+    auto state = mm::MemoryState{{{0, 0, 128}, //
+                                  {-1, 128, 128}},
+                                 {{-1, 128, 128}}};
+
+    auto expected = state;
+    auto actual = strategy->processRequest(request, state);
+    REQUIRE(actual == expected);
+  }
+}
+
+TEST_CASE("MemoryManagement::TlsfStrategy") {
+  SECTION("Создать экземпляр TlsfStrategy") {
+    auto strategy = mm::TlsfStrategy::create();
+
+    REQUIRE(strategy->type == mm::StrategyType::TLSF);
+  }
+
+  SECTION("Обработать заявку CreateProcessReq") {
+    auto strategy = mm::TlsfStrategy::create();
+    auto request = mm::CreateProcessReq(2, 33 * 4096);
+
+    // блок размера 33 относится к тому же классу, что и запрос, поэтому
+    // выбирается блок следующего класса
+    auto state = mm::MemoryState{{{0, 0, 100},   //
+                                  {-1, 100, 33}, //
+                                  {1, 133, 83},  //
+                                  {-1, 216, 40}}, //<- блок, в котором будет
+                                                  // выделена память
+                                 {{-1, 100, 33}, //
+                                  {-1, 216, 40}}};
+
+    auto expected = mm::MemoryState{{{0, 0, 100},   //
+                                     {-1, 100, 33}, //
+                                     {1, 133, 83},  //
+                                     {2, 216, 33},  //
+                                     {-1, 249, 7}},
+                                    {{-1, 249, 7}, //
+                                     {-1, 100, 33}}};
+    auto actual = strategy->processRequest(request, state);
+    REQUIRE(actual == expected);
+  }
+
+  SECTION("Обработать заявку CreateProcessReq (блок того же класса)") {
+    auto strategy = mm::TlsfStrategy::create();
+    auto request = mm::CreateProcessReq(2, 33 * 4096);
+
+    auto state = mm::MemoryState{{{0, 0, 100},   //
+                                  {-1, 100, 33}, //
+                                  {1, 133, 123}},
+                                 {{-1, 100, 33}}};
+
+    auto expected = mm::MemoryState{{{0, 0, 100}, //
+                                     {2, 100, 33}, //
+                                     {1, 133, 123}},
+                                    {}};
+    auto actual = strategy->processRequest(request, state);
+    REQUIRE(actual == expected);
+  }
+
+  SECTION("Обработать заявку CreateProcessReq (с дефрагментацией)") {
+    auto strategy = mm::TlsfStrategy::create();
+    auto request = mm::CreateProcessReq(2, 25 * 4096);
+
+    auto state = mm::MemoryState{{{-1, 0, 10},   //
+                                  {0, 10, 100},  //
+                                  {-1, 110, 20}, //
+                                  {1, 130, 126}},
+                                 {{-1, 0, 10}, //
+                                  {-1, 110, 20}}};
+
+    auto expected = mm::MemoryState{{{0, 0, 100},   //
+                                     {1, 100, 126}, //
+                                     {2, 226, 25},  //
+                                     {-1, 251, 5}},
+                                    {{-1, 251, 5}}};
+    auto actual = strategy->processRequest(request, state);
+    REQUIRE(actual == expected);
+  }
+
+  SECTION("Обработать заявку TerminateProcessReq") {
+    auto strategy = mm::TlsfStrategy::create();
+    auto request = mm::TerminateProcessReq(0);
+
+    auto state = mm::MemoryState{{{0, 0, 100},   //
+                                  {-1, 100, 33}, //
+                                  {0, 133, 83},  //
+                                  {-1, 216, 40}},
+                                 {{-1, 100, 33}, //
+                                  {-1, 216, 40}}};
+
+    auto expected = mm::MemoryState::initial();
+    auto actual = strategy->processRequest(request, state);
+    REQUIRE(actual == expected);
+  }
+
+  SECTION("Обработать заявку FreeMemory") {
+    auto strategy = mm::TlsfStrategy::create();
+    auto request = mm::FreeMemory(0, 133);
+
+    // освобожденный блок сразу объединяется с соседними свободными блоками
+    auto state = mm::MemoryState{{{0, 0, 100},   //
+                                  {-1, 100, 33}, //
+                                  {0, 133, 83},  //
+                                  {-1, 216, 40}},
+                                 {{-1, 100, 33}, //
+                                  {-1, 216, 40}}};
+
+    auto expected = mm::MemoryState{{{0, 0, 100}, //
+                                     {-1, 100, 156}},
+                                    {{-1, 100, 156}}};
+    auto actual = strategy->processRequest(request, state);
+    REQUIRE(actual == expected);
+  }
+}
+
+TEST_CASE("MemoryManagement::NextAppropriateStrategy") {
+  // поиск начинается с блока по адресу 42
+  auto state = mm::MemoryState{{{0, 0, 12},   //
+                                {-1, 12, 10}, //
+                                {1, 22, 20},  //
+                                {-1, 42, 30}, //
+                                {2, 72, 184}},
+                               {{-1, 42, 30}, //
+                                {-1, 12, 10}}};
+
+  SECTION("Создать экземпляр NextAppropriateStrategy") {
+    auto strategy = mm::NextAppropriateStrategy::create();
+
+    REQUIRE(strategy->type == mm::StrategyType::NEXT_APPROPRIATE);
+  }
+
+  SECTION("Обработать заявку CreateProcessReq") {
+    auto strategy = mm::NextAppropriateStrategy::create();
+    auto request = mm::CreateProcessReq(3, 5 * 4096);
+
+    auto expected = mm::MemoryState{{{0, 0, 12},   //
+                                     {-1, 12, 10}, //
+                                     {1, 22, 20},  //
+                                     {3, 42, 5},   //
+                                     {-1, 47, 25}, //
+                                     {2, 72, 184}},
+                                    {{-1, 47, 25}, //
+                                     {-1, 12, 10}}};
+    auto actual = strategy->processRequest(request, state);
+    REQUIRE(actual == expected);
+  }
+
+  SECTION("Обработать заявку CreateProcessReq (блок занят целиком)") {
+    auto strategy = mm::NextAppropriateStrategy::create();
+    auto request = mm::CreateProcessReq(3, 30 * 4096);
+
+    // после конца памяти поиск продолжается с ее начала
+    auto expected = mm::MemoryState{{{0, 0, 12},   //
+                                     {-1, 12, 10}, //
+                                     {1, 22, 20},  //
+                                     {3, 42, 30},  //
+                                     {2, 72, 184}},
+                                    {{-1, 12, 10}}};
+    auto actual = strategy->processRequest(request, state);
+    REQUIRE(actual == expected);
+  }
+
+  SECTION("Обработать заявку AllocateMemory (поиск по кругу)") {
+    auto strategy = mm::NextAppropriateStrategy::create();
+    auto request = mm::AllocateMemory(1, 5 * 4096);
+
+    auto small = mm::MemoryState{{{0, 0, 12},   //
+                                  {-1, 12, 10}, //
+                                  {1, 22, 20},  //
+                                  {-1, 42, 3},  //
+                                  {2, 45, 211}},
+                                 {{-1, 42, 3}, //
+                                  {-1, 12, 10}}};
+
+    auto expected = mm::MemoryState{{{0, 0, 12},  //
+                                     {1, 12, 5},  //
+                                     {-1, 17, 5}, //
+                                     {1, 22, 20}, //
+                                     {-1, 42, 3}, //
+                                     {2, 45, 211}},
+                                    {{-1, 17, 5}, //
+                                     {-1, 42, 3}}};
+    auto actual = strategy->processRequest(request, small);
+    REQUIRE(actual == expected);
+  }
+
+  SECTION("Обработать заявку AllocateMemory (с дефрагментацией)") {
+    auto strategy = mm::NextAppropriateStrategy::create();
+    auto request = mm::AllocateMemory(1, 35 * 4096);
+
+    auto expected = mm::MemoryState{{{0, 0, 12},   //
+                                     {1, 12, 20},  //
+                                     {2, 32, 184}, //
+                                     {1, 216, 35}, //
+                                     {-1, 251, 5}},
+                                    {{-1, 251, 5}}};
+    auto actual = strategy->processRequest(request, state);
+    REQUIRE(actual == expected);
+  }
+
+  SECTION("Обработать заявку FreeMemory") {
+    auto strategy = mm::NextAppropriateStrategy::create();
+    auto request = mm::FreeMemory(0, 0);
+
+    // освобожденный блок не меняет место продолжения поиска
+    auto expected = mm::MemoryState{{{-1, 0, 22},  //
+                                     {1, 22, 20},  //
+                                     {-1, 42, 30}, //
+                                     {2, 72, 184}},
+                                    {{-1, 42, 30}, //
+                                     {-1, 0, 22}}};
+    auto actual = strategy->processRequest(request, state);
+    REQUIRE(actual == expected);
+  }
+
+  SECTION("Обработать заявку TerminateProcessReq") {
+    auto strategy = mm::NextAppropriateStrategy::create();
+    auto request = mm::TerminateProcessReq(1);
+
+    // блок, с которого начинается поиск, объединен с предшествующими
+    auto expected = mm::MemoryState{{{0, 0, 12},   //
+                                     {-1, 12, 60}, //
+                                     {2, 72, 184}},
+                                    {{-1, 12, 60}}};
+    auto actual = strategy->processRequest(request, state);
+    REQUIRE(actual == expected);
+  }
+}
@@ -0,0 +1,55 @@
+#include <cstdint>
+#include <limits>
+
+#include <catch2/catch.hpp>
+
+#include <algo/memory/tlsf.h>
+
+namespace mm = MemoryManagement;
+
+TEST_CASE("MemoryManagement::TlsfIndex") {
+  SECTION("Классы размеров блоков") {
+    // размеры меньше 2^SL_BITS относятся к отдельным классам
+    REQUIRE(mm::TlsfIndex::classOf(1) == 0);
+    REQUIRE(mm::TlsfIndex::classOf(2) == 16);
+    REQUIRE(mm::TlsfIndex::classOf(3) == 24);
+    REQUIRE(mm::TlsfIndex::classOf(16) == 64);
+    REQUIRE(mm::TlsfIndex::classOf(31) == 79);
+
+    // начиная с 2^(SL_BITS + 1) класс объединяет несколько размеров
+    REQUIRE(mm::TlsfIndex::classOf(32) == 80);
+    REQUIRE(mm::TlsfIndex::classOf(33) == 80);
+    REQUIRE(mm::TlsfIndex::classOf(34) == 81);
+    REQUIRE(mm::TlsfIndex::classOf(std::numeric_limits<int32_t>::max()) ==
+            30 * 16 + 15);
+
+    REQUIRE(mm::TlsfIndex::searchClassOf(3) == 24);
+    REQUIRE(mm::TlsfIndex::searchClassOf(32) == 80);
+    REQUIRE(mm::TlsfIndex::searchClassOf(33) == 81);
+  }
+
+  SECTION("Поиск непустого класса") {
+    mm::TlsfIndex index;
+    REQUIRE(!index.findClass(0).has_value());
+
+    index.insert(33);
+    index.insert(32);
+    index.insert(100);
+    REQUIRE(index.count(80) == 2);
+    REQUIRE(index.findClass(0) == 80);
+    REQUIRE(index.findClass(80) == 80);
+    REQUIRE(index.findClass(81) == 105);
+
+    index.erase(33);
+    REQUIRE(index.findClass(0) == 80);
+    index.erase(32);
+    REQUIRE(index.findClass(0) == 105);
+    index.erase(100);
+    REQUIRE(!index.findClass(0).has_value());
+
+    index.insert(std::numeric_limits<int32_t>::max());
+    REQUIRE(index.findClass(495) == 495);
+    index.clear();
+    REQUIRE(!index.findClass(0).has_value());
+  }
+}
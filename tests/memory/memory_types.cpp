@@ -9,6 +9,46 @@
 namespace mm = MemoryManagement;
 using std::vector;
 
+TEST_CASE("MemoryManagement::MemoryConfig") {
+  SECTION("Создать экземпляр MemoryConfig") {
+    mm::MemoryConfig config{1 << 20, 512};
+
+    REQUIRE(config.pages() == 1 << 20);
+    REQUIRE(config.pageSize() == 512);
+    REQUIRE(config.bytes() == (int64_t(1) << 29));
+  }
+
+  SECTION("Создать экземпляр MemoryConfig (по умолчанию)") {
+    mm::MemoryConfig config;
+
+    REQUIRE(config.pages() == 256);
+    REQUIRE(config.pageSize() == 4096);
+  }
+
+  SECTION("Перевести байты в страницы") {
+    mm::MemoryConfig config{1024, 512};
+
+    REQUIRE(config.toPages(1) == 1);
+    REQUIRE(config.toPages(512) == 1);
+    REQUIRE(config.toPages(513) == 2);
+    REQUIRE(config.toPages(1024 * 512) == 1024);
+  }
+
+  SECTION("Получить JSON экземпляра MemoryConfig") {
+    mm::MemoryConfig config{1024, 512};
+
+    auto expected = nlohmann::json{{"pages", 1024}, //
+                                   {"page_size", 512}};
+
+    REQUIRE(config.dump() == expected);
+  }
+
+  SECTION("Ограничения на параметры MemoryConfig") {
+    REQUIRE_THROWS_AS(mm::MemoryConfig(0, 4096), mm::TypeException);
+    REQUIRE_THROWS_AS(mm::MemoryConfig(256, 0), mm::TypeException);
+  }
+}
+
 TEST_CASE("MemoryManagement::MemoryBlock") {
   SECTION("Создать экземпляр MemoryBlock (свободный блок)") {
     mm::MemoryBlock block{-1, 0, 10};
@@ -53,6 +93,14 @@ TEST_CASE("MemoryManagement::MemoryBlock") {
     // Несоответствие между размером и адресом начала блока
     REQUIRE_THROWS_AS(mm::MemoryBlock(0, 1, 256), mm::TypeException);
   }
+
+  SECTION("Ограничения на параметры MemoryBlock (размер памяти)") {
+    REQUIRE_NOTHROW(mm::MemoryBlock(0, 1000, 24, 1024));
+    REQUIRE_THROWS_AS(mm::MemoryBlock(0, 1024, 1, 1024), mm::TypeException);
+    REQUIRE_THROWS_AS(mm::MemoryBlock(0, 1000, 25, 1024), mm::TypeException);
+    REQUIRE_THROWS_AS(mm::MemoryBlock(0, 0x7fff0000, 0x7fff0000, 0x7fffffff),
+                      mm::TypeException);
+  }
 }
 
 TEST_CASE("MemoryManagement::MemoryState") {
@@ -78,6 +126,22 @@ TEST_CASE("MemoryManagement::MemoryState") {
     REQUIRE(actual == expected);
   }
 
+  SECTION("Создать экземпляр MemoryState (размер памяти)") {
+    mm::MemoryConfig config{1 << 20, 512};
+    auto actual = mm::MemoryState::initial(config);
+
+    REQUIRE(actual.config == config);
+    REQUIRE(actual.blocks.size() == 1);
+    REQUIRE(actual.blocks[0].size() == 1 << 20);
+    REQUIRE(actual.freeBlocks == actual.blocks);
+    REQUIRE(actual != mm::MemoryState::initial());
+    REQUIRE_NOTHROW(mm::MemoryState::validate(
+        actual.blocks, actual.freeBlocks, actual.config));
+    REQUIRE_THROWS_AS(mm::MemoryState::validate(
+                          actual.blocks, actual.freeBlocks, {1024, 512}),
+                      mm::TypeException);
+  }
+
   SECTION("Получить JSON экземпляра MemoryState") {
     vector<mm::MemoryBlock> blocks = {{0, 0, 12},   //
                                       {2, 12, 3},   //
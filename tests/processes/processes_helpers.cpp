@@ -1,5 +1,5 @@
-#include <array>
 #include <deque>
+#include <vector>
 
 #include <catch2/catch.hpp>
 
@@ -7,7 +7,7 @@
 #include <algo/processes/types.h>
 
 namespace pm = ProcessesManagement;
-using Queues = std::array<std::deque<int32_t>, 16>;
+using Queues = std::vector<std::deque<int32_t>>;
 
 TEST_CASE("ProcessesManagement::getIndexByPid") {
   SECTION("Поиск процесса по PID [getIndexByPid(state, index)]") {
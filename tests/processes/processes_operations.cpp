@@ -1,5 +1,5 @@
-#include <array>
 #include <deque>
+#include <vector>
 
 #include <catch2/catch.hpp>
 
@@ -8,7 +8,7 @@
 #include <algo/processes/types.h>
 
 namespace pm = ProcessesManagement;
-using Queues = std::array<std::deque<int32_t>, 16>;
+using Queues = std::vector<std::deque<int32_t>>;
 
 TEST_CASE("ProcessesManagement::changeProcessState") {
   SECTION("Изменение состояния процесса") {
@@ -57,6 +57,23 @@ TEST_CASE("ProcessesManagement::pushToQueue") {
     REQUIRE(actualState == expectedState);
   }
 
+  SECTION("Добавить процесс в очередь (параметры модели)") {
+    pm::ProcessesConfig config{140, 1 << 17};
+    auto state = pm::ProcessesState{
+        {pm::Process{}.pid(100000, config)}, Queues{}, config};
+
+    auto expectedState = pm::ProcessesState{
+        {pm::Process{}.pid(100000, config).priority(139, config)},
+        {{139, {100000}}},
+        config};
+
+    auto actualState = pushToQueue(state, 139, 100000);
+    REQUIRE(actualState == expectedState);
+    REQUIRE(popFromQueue(actualState, 139).queues.at(139).empty());
+    REQUIRE(terminateProcess(actualState, 100000) ==
+            pm::ProcessesState::initial(config));
+  }
+
   SECTION("Добавить процесс в очередь (процесс не существует)") {
     auto state = pm::ProcessesState{// processes
                                     {},
@@ -189,6 +206,38 @@ TEST_CASE("ProcessesManagement::terminateProcess") {
     REQUIRE(actualState == expectedState);
   }
 
+  SECTION("Завершение процесса (без дочерних процессов)") {
+    auto state = pm::ProcessesState{                               // processes
+                                    {pm::Process{}.pid(0),         //
+                                     pm::Process{}.pid(1).ppid(0), //
+                                     pm::Process{}.pid(2).ppid(1), //
+                                     pm::Process{}.pid(3),         //
+                                     pm::Process{}.pid(4).ppid(3)},
+                                    // queues
+                                    {{0, {0, 1}}, //
+                                     {1, {3, 4, 2}}}};
+
+    auto expectedState = pm::ProcessesState{                       // processes
+                                            {pm::Process{}.pid(0), //
+                                             pm::Process{}.pid(2).ppid(1),
+                                             pm::Process{}.pid(3), //
+                                             pm::Process{}.pid(4).ppid(3)},
+                                            // queues
+                                            {{0, {0}}, //
+                                             {1, {3, 4, 2}}}};
+
+    auto actualState = terminateProcess(state, 1, false);
+    REQUIRE(actualState == expectedState);
+    REQUIRE(actualState.indexOf(4) == 3u);
+    REQUIRE(!actualState.queueOf(1).has_value());
+
+    // Процесс 2 остается дочерним для PID 1 и завершается вместе с
+    // процессом, созданным с этим PID
+    actualState = addProcess(actualState, pm::Process{}.pid(1).ppid(3));
+    actualState = terminateProcess(actualState, 3);
+    REQUIRE(actualState.processes == std::vector{pm::Process{}.pid(0)});
+  }
+
   SECTION("Завершение процесса (процесс не существует)") {
     auto state = pm::ProcessesState{                               // processes
                                     {pm::Process{}.pid(0),         //
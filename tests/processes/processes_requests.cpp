@@ -60,6 +60,25 @@ TEST_CASE("ProcessesManagement::CreateProcessReq") {
                       pm::RequestException);
   }
 
+  SECTION("Ограничения на параметры CreateProcessReq (параметры модели)") {
+    pm::ProcessesConfig config{140, 1 << 17};
+    auto request = pm::CreateProcessReq(100000, 99999, 139, 100, 0, 0, config);
+
+    REQUIRE(request.pid() == 100000);
+    REQUIRE(request.priority() == 139);
+    REQUIRE(request.toProcess(config).pid() == 100000);
+    REQUIRE_THROWS_AS(pm::CreateProcessReq(1 << 17, -1, 0, 0, 0, 0, config),
+                      pm::RequestException);
+    REQUIRE_THROWS_AS(pm::CreateProcessReq(0, -1, 140, 0, 0, 0, config),
+                      pm::RequestException);
+    REQUIRE_THROWS_AS(pm::TerminateProcessReq(1 << 17, config),
+                      pm::RequestException);
+    REQUIRE_THROWS_AS(pm::TerminateIO(0, 140, config), pm::RequestException);
+    REQUIRE_NOTHROW(pm::TerminateIO(100000, 139, config));
+    REQUIRE_NOTHROW(pm::InitIO(100000, config));
+    REQUIRE_NOTHROW(pm::TransferControl(100000, config));
+  }
+
   SECTION("Получение экземпляра Process") {
     auto request = pm::CreateProcessReq(0, -1, 0, 0, 0, 0);
 
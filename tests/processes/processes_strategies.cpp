@@ -0,0 +1,278 @@
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+#include <catch2/catch.hpp>
+
+#include <algo/processes/exceptions.h>
+#include <algo/processes/requests.h>
+#include <algo/processes/strategies.h>
+#include <algo/processes/types.h>
+
+namespace pm = ProcessesManagement;
+
+TEST_CASE("ProcessesManagement::SjnStrategy") {
+  SECTION("Создать экземпляр SjnStrategy") {
+    pm::StrategyPtr strategy = pm::SjnStrategy::create();
+
+    REQUIRE(strategy->type() == pm::StrategyType::SJN);
+  }
+
+  SECTION("Обработать заявку CreateProcessReq") {
+    pm::StrategyPtr strategy = pm::SjnStrategy::create();
+    pm::Request request = pm::CreateProcessReq(3, 0, 0, 0, 0, 5);
+
+    auto state = pm::ProcessesState{
+        {pm::Process{}.pid(0).workTime(10).state(pm::ProcState::EXECUTING),
+         pm::Process{}.pid(1).workTime(3),
+         pm::Process{}.pid(2).workTime(5),
+         pm::Process{}.pid(4).workTime(2).timer(3)}, //<- превысил время
+        {{0, {1, 2, 4}}}};
+
+    auto expected = pm::ProcessesState{
+        {pm::Process{}.pid(0).workTime(10).timer(1).state(
+             pm::ProcState::EXECUTING),
+         pm::Process{}.pid(1).workTime(3),
+         pm::Process{}.pid(2).workTime(5),
+         pm::Process{}.pid(3).ppid(0).workTime(5), //<- после процесса 2
+         pm::Process{}.pid(4).workTime(2).timer(3)},
+        {{0, {1, 2, 3, 4}}}};
+    auto actual = strategy->processRequest(request, state);
+    REQUIRE(actual == expected);
+  }
+
+  SECTION("Проверить порядок очереди") {
+    pm::StrategyPtr strategy = pm::SjnStrategy::create();
+
+    auto ordered = pm::ProcessesState{
+        {pm::Process{}.pid(0).workTime(10).state(pm::ProcState::EXECUTING),
+         pm::Process{}.pid(1).workTime(3),
+         pm::Process{}.pid(2).workTime(5),
+         pm::Process{}.pid(4).workTime(2).timer(3)},
+        {{0, {1, 2, 4}}}};
+    REQUIRE_NOTHROW(strategy->validateState(ordered));
+
+    auto unordered = pm::ProcessesState{
+        {pm::Process{}.pid(0).workTime(10).state(pm::ProcState::EXECUTING),
+         pm::Process{}.pid(1).workTime(5),
+         pm::Process{}.pid(2).workTime(3)},
+        {{0, {1, 2}}}};
+    REQUIRE_THROWS_AS(strategy->validateState(unordered), pm::TypeException);
+
+    // процесс, проработавший дольше заявленного времени, не в конце очереди
+    auto overdue = pm::ProcessesState{
+        {pm::Process{}.pid(1).workTime(2).timer(3),
+         pm::Process{}.pid(2).workTime(3)},
+        {{0, {1, 2}}}};
+    REQUIRE_THROWS_AS(strategy->validateState(overdue), pm::TypeException);
+  }
+}
+
+TEST_CASE("ProcessesManagement::SrtStrategy") {
+  SECTION("Создать экземпляр SrtStrategy") {
+    pm::StrategyPtr strategy = pm::SrtStrategy::create();
+
+    REQUIRE(strategy->type() == pm::StrategyType::SRT);
+  }
+
+  SECTION("Обработать заявку TerminateIO") {
+    pm::StrategyPtr strategy = pm::SrtStrategy::create();
+    pm::Request request = pm::TerminateIO(5);
+
+    auto state = pm::ProcessesState{
+        {pm::Process{}.pid(0).workTime(10).state(pm::ProcState::EXECUTING),
+         pm::Process{}.pid(1).workTime(3),
+         pm::Process{}.pid(2).workTime(5),
+         pm::Process{}.pid(5).workTime(6).timer(3).state(
+             pm::ProcState::WAITING)},
+        {{0, {1, 2}}}};
+
+    auto expected = pm::ProcessesState{
+        {pm::Process{}.pid(0).workTime(10).timer(1).state(
+             pm::ProcState::EXECUTING),
+         pm::Process{}.pid(1).workTime(3),
+         pm::Process{}.pid(2).workTime(5),
+         pm::Process{}.pid(5).workTime(6).timer(3)}, //<- осталось 3 единицы
+        {{0, {1, 5, 2}}}};
+    auto actual = strategy->processRequest(request, state);
+    REQUIRE(actual == expected);
+  }
+}
+
+TEST_CASE("ProcessesManagement::UnixStrategy") {
+  SECTION("Создать экземпляр UnixStrategy") {
+    pm::StrategyPtr strategy = pm::UnixStrategy::create();
+
+    REQUIRE(strategy->type() == pm::StrategyType::UNIX);
+  }
+
+  SECTION("Понижение приоритета выполняющегося процесса") {
+    pm::StrategyPtr strategy = pm::UnixStrategy::create();
+    pm::Request request = pm::TransferControl(2);
+
+    auto state = pm::ProcessesState{
+        {pm::Process{}.pid(1).priority(3).state(pm::ProcState::EXECUTING),
+         pm::Process{}.pid(2).priority(10).state(pm::ProcState::WAITING)},
+        {}};
+
+    std::vector<std::size_t> priorities;
+    for (int i = 0; i < 6; ++i) {
+      state = strategy->processRequest(request, state);
+      priorities.push_back(state.processes.at(0).priority());
+    }
+    // Таймер: 0, 1, 2, 3, 4, 5
+    REQUIRE(priorities == std::vector<std::size_t>{3, 3, 2, 2, 1, 1});
+    REQUIRE(state.processes.at(0).timer() == 6);
+  }
+}
+
+TEST_CASE("ProcessesManagement::CfsStrategy") {
+  SECTION("Создать экземпляр CfsStrategy") {
+    pm::StrategyPtr strategy = pm::CfsStrategy::create();
+
+    REQUIRE(strategy->type() == pm::StrategyType::CFS);
+    REQUIRE(pm::CfsStrategy::weight(0) == 1024);
+    REQUIRE(pm::CfsStrategy::weight(20) == 88761);
+    REQUIRE(pm::CfsStrategy::weight(100) == 88761);
+  }
+
+  SECTION("Обработать заявку TimeQuantumExpired") {
+    pm::StrategyPtr strategy = pm::CfsStrategy::create();
+    pm::Request request = pm::TimeQuantumExpired();
+
+    auto state = pm::ProcessesState{
+        {pm::Process{}.pid(1).timer(5).state(pm::ProcState::EXECUTING),
+         pm::Process{}.pid(2).timer(5),
+         pm::Process{}.pid(3).priority(1).timer(6)},
+        {{0, {2}}, {1, {3}}}};
+
+    // У процесса 3 больший вес, поэтому его виртуальное время меньше
+    auto expected = pm::ProcessesState{
+        {pm::Process{}.pid(1).timer(5),
+         pm::Process{}.pid(2).timer(5),
+         pm::Process{}.pid(3).priority(1).timer(7).state(
+             pm::ProcState::EXECUTING)},
+        {{0, {2, 1}}}};
+    auto actual = strategy->processRequest(request, state);
+    REQUIRE(actual == expected);
+  }
+
+  SECTION("Обработать заявку TerminateIO") {
+    pm::StrategyPtr strategy = pm::CfsStrategy::create();
+    pm::Request request = pm::TerminateIO(4);
+
+    auto state = pm::ProcessesState{
+        {pm::Process{}.pid(1).timer(5).state(pm::ProcState::EXECUTING),
+         pm::Process{}.pid(2).timer(2),
+         pm::Process{}.pid(3).timer(6),
+         pm::Process{}.pid(4).timer(3).state(pm::ProcState::WAITING)},
+        {{0, {2, 3}}}};
+
+    auto expected = pm::ProcessesState{
+        {pm::Process{}.pid(1).timer(6).state(pm::ProcState::EXECUTING),
+         pm::Process{}.pid(2).timer(2),
+         pm::Process{}.pid(3).timer(6),
+         pm::Process{}.pid(4).timer(3)},
+        {{0, {2, 4, 3}}}};
+    auto actual = strategy->processRequest(request, state);
+    REQUIRE(actual == expected);
+  }
+
+  SECTION("Проверить порядок очередей") {
+    pm::StrategyPtr strategy = pm::CfsStrategy::create();
+
+    auto ordered = pm::ProcessesState{
+        {pm::Process{}.pid(1).timer(5).state(pm::ProcState::EXECUTING),
+         pm::Process{}.pid(2).timer(2),
+         pm::Process{}.pid(3).timer(6),
+         pm::Process{}.pid(4).priority(1).timer(1)},
+        {{0, {2, 3}}, {1, {4}}}};
+    REQUIRE_NOTHROW(strategy->validateState(ordered));
+
+    auto unordered = pm::ProcessesState{
+        {pm::Process{}.pid(2).timer(2), pm::Process{}.pid(3).timer(6)},
+        {{0, {3, 2}}}};
+    REQUIRE_THROWS_AS(strategy->validateState(unordered), pm::TypeException);
+  }
+}
+
+TEST_CASE("ProcessesManagement::StaticStrategy") {
+  std::vector<pm::StrategyPtr> strategies = {pm::RoundRobinStrategy::create(),
+                                             pm::FcfsStrategy::create(),
+                                             pm::SjnStrategy::create(),
+                                             pm::SrtStrategy::create(),
+                                             pm::WinNtStrategy::create(),
+                                             pm::UnixStrategy::create(),
+                                             pm::LinuxO1Strategy::create(),
+                                             pm::CfsStrategy::create()};
+
+  SECTION("Преобразовать StrategyPtr в StaticStrategy") {
+    auto srt = pm::toStaticStrategy(pm::SrtStrategy::create());
+    REQUIRE(srt.is<std::shared_ptr<pm::SrtStrategy>>());
+
+    auto sjn = pm::toStaticStrategy(pm::SjnStrategy::create());
+    REQUIRE(sjn.is<std::shared_ptr<pm::SjnStrategy>>());
+  }
+
+  SECTION("Обработать последовательность заявок") {
+    std::vector<pm::Request> requests = {pm::CreateProcessReq(1, -1, 3),
+                                         pm::CreateProcessReq(2, 1, 5, 0, 0, 4),
+                                         pm::CreateProcessReq(3, 1, 1, 0, 0, 2),
+                                         pm::TimeQuantumExpired(),
+                                         pm::InitIO(2),
+                                         pm::TransferControl(1),
+                                         pm::TerminateIO(2, 2),
+                                         pm::TimeQuantumExpired(),
+                                         pm::TerminateProcessReq(1),
+                                         pm::TimeQuantumExpired()};
+
+    for (const auto &strategy : strategies) {
+      auto staticStrategy = pm::toStaticStrategy(strategy);
+      auto expected = pm::ProcessesState::initial();
+      auto actual = pm::ProcessesState::initial();
+      for (const auto &request : requests) {
+        expected = strategy->processRequest(request, expected);
+        actual = pm::dispatchRequest(staticStrategy, request, actual);
+        REQUIRE(actual == expected);
+      }
+    }
+  }
+}
+
+TEST_CASE("ProcessesManagement::AbstractStrategy::processRequests") {
+  pm::StrategyPtr strategy = pm::WinNtStrategy::create();
+  std::vector<pm::Request> requests = {pm::CreateProcessReq(1, -1, 3, 3),
+                                       pm::CreateProcessReq(2, 1, 5, 2),
+                                       pm::InitIO(2),
+                                       pm::TerminateIO(2, 2),
+                                       pm::TimeQuantumExpired(),
+                                       pm::TerminateProcessReq(1)};
+
+  auto state = pm::ProcessesState::initial();
+  std::vector<pm::ProcessesState> expected;
+  for (const auto &request : requests) {
+    state = strategy->processRequest(request, state);
+    expected.push_back(state);
+  }
+
+  SECTION("Обработать последовательность заявок") {
+    auto actual = strategy->processRequests(
+        requests.begin(), requests.end(), pm::ProcessesState::initial());
+    REQUIRE(actual == state);
+  }
+
+  SECTION("Получить состояния процессов после выбранных заявок") {
+    std::vector<pm::ProcessesState> snapshots;
+    strategy->processRequests(
+        requests.begin(),
+        requests.end(),
+        pm::ProcessesState::initial(),
+        [&snapshots](std::size_t index, const pm::ProcessesState &current) {
+          if (index % 2 == 1) {
+            snapshots.push_back(current);
+          }
+        });
+    REQUIRE(snapshots == std::vector<pm::ProcessesState>{
+                             expected[1], expected[3], expected[5]});
+  }
+}
@@ -1,4 +1,5 @@
 #include <algorithm>
+#include <deque>
 
 #include <catch2/catch.hpp>
 #include <nlohmann/json.hpp>
@@ -9,6 +10,38 @@
 namespace pm = ProcessesManagement;
 using std::vector;
 
+TEST_CASE("ProcessesManagement::ProcessesConfig") {
+  SECTION("Создать экземпляр ProcessesConfig") {
+    pm::ProcessesConfig config{140, 1 << 17};
+
+    REQUIRE(config.priorities() == 140);
+    REQUIRE(config.pids() == 1 << 17);
+    REQUIRE(config.maxPriority() == 139);
+    REQUIRE(config.maxPid() == (1 << 17) - 1);
+  }
+
+  SECTION("Создать экземпляр ProcessesConfig (по умолчанию)") {
+    pm::ProcessesConfig config;
+
+    REQUIRE(config.priorities() == 16);
+    REQUIRE(config.pids() == 256);
+  }
+
+  SECTION("Получить JSON экземпляра ProcessesConfig") {
+    pm::ProcessesConfig config{140, 1024};
+
+    auto expected = nlohmann::json{{"priorities", 140}, //
+                                   {"pids", 1024}};
+
+    REQUIRE(config.dump() == expected);
+  }
+
+  SECTION("Ограничения на параметры ProcessesConfig") {
+    REQUIRE_THROWS_AS(pm::ProcessesConfig(1, 256), pm::TypeException);
+    REQUIRE_THROWS_AS(pm::ProcessesConfig(16, 0), pm::TypeException);
+  }
+}
+
 TEST_CASE("ProcessesManagement::Process") {
   SECTION("Создать экземпляр Process") {
     pm::Process process;
@@ -66,6 +99,25 @@ TEST_CASE("ProcessesManagement::Process") {
     REQUIRE_THROWS_AS(pm::Process{}.workTime(-1),
                       ProcessesManagement::TypeException);
   }
+
+  SECTION("Ограничения на параметры Process (параметры модели)") {
+    pm::ProcessesConfig config{140, 1 << 17};
+
+    auto process = pm::Process{}
+                       .pid(100000, config)
+                       .ppid(99999, config)
+                       .priority(139, config)
+                       .basePriority(120, config);
+    REQUIRE(process.pid() == 100000);
+    REQUIRE(process.ppid() == 99999);
+    REQUIRE(process.priority() == 139);
+    REQUIRE(process.basePriority() == 120);
+
+    REQUIRE_THROWS_AS(pm::Process{}.pid(1 << 17, config), pm::TypeException);
+    REQUIRE_THROWS_AS(pm::Process{}.ppid(1 << 17, config), pm::TypeException);
+    REQUIRE_THROWS_AS(pm::Process{}.priority(140, config), pm::TypeException);
+    REQUIRE_THROWS_AS(pm::Process{}.priority(4, {4, 256}), pm::TypeException);
+  }
 }
 
 TEST_CASE("ProcessesManagement::ProcessesState") {
@@ -127,4 +179,262 @@ TEST_CASE("ProcessesManagement::ProcessesState") {
 
     REQUIRE(actual == expected);
   }
+
+  SECTION("Создать экземпляр ProcessesState (параметры модели)") {
+    pm::ProcessesConfig config{140, 1 << 17};
+    auto process = pm::Process{}.pid(100000, config).priority(139, config);
+    auto state = pm::ProcessesState::initial(config);
+
+    REQUIRE(state.config == config);
+    REQUIRE(state.queues.size() == 140);
+    REQUIRE(state != pm::ProcessesState::initial());
+
+    state = pm::ProcessesState{{process}, {{139, {100000}}}, config};
+    REQUIRE(state.queueOf(100000) == 139u);
+    REQUIRE(state.highestNonEmptyQueue() == 139u);
+    REQUIRE(state.dump()["queues"].size() == 140);
+    REQUIRE_NOTHROW(
+        pm::ProcessesState::validate(state.processes, state.queues, config));
+
+    // Количество очередей не совпадает с количеством уровней приоритета
+    REQUIRE_THROWS_AS(pm::ProcessesState::validate(state.processes,
+                                                   state.queues),
+                      pm::TypeException);
+    // PID вне допустимого диапазона
+    REQUIRE_THROWS_AS(
+        pm::ProcessesState::validate(state.processes, state.queues, {140, 256}),
+        pm::TypeException);
+  }
+
+  SECTION("Индекс процессов ProcessesState") {
+    pm::ProcessesState state{// processes
+                             {pm::Process{}.pid(0),
+                              pm::Process{}.pid(3).ppid(0),
+                              pm::Process{}.pid(7).ppid(0).state(
+                                  pm::ProcState::EXECUTING)},
+                             // queues
+                             {{0, {}}}};
+
+    REQUIRE(state.indexOf(0) == 0u);
+    REQUIRE(state.indexOf(3) == 1u);
+    REQUIRE(state.indexOf(7) == 2u);
+    REQUIRE(!state.indexOf(1).has_value());
+    REQUIRE(!state.indexOf(255).has_value());
+    REQUIRE(!state.indexOf(-1).has_value());
+    REQUIRE(state.executingIndex() == 2u);
+
+    state.setProcess(2, state.processes.at(2).state(pm::ProcState::ACTIVE));
+    REQUIRE(!state.executingIndex().has_value());
+
+    state.setProcess(1, state.processes.at(1).state(pm::ProcState::EXECUTING));
+    REQUIRE(state.executingIndex() == 1u);
+
+    state.setProcess(1, pm::Process{}.pid(5).ppid(0));
+    REQUIRE(!state.indexOf(3).has_value());
+    REQUIRE(state.indexOf(5) == 1u);
+    REQUIRE(!state.executingIndex().has_value());
+
+    state.processes.erase(state.processes.begin());
+    state.reindex();
+    REQUIRE(!state.indexOf(0).has_value());
+    REQUIRE(state.indexOf(5) == 0u);
+    REQUIRE(state.indexOf(7) == 1u);
+  }
+
+  SECTION("Таблица очередей ProcessesState") {
+    pm::ProcessesState state{// processes
+                             {pm::Process{}.pid(1),
+                              pm::Process{}.pid(2).priority(3),
+                              pm::Process{}.pid(4).state(
+                                  pm::ProcState::WAITING)},
+                             // queues
+                             {{0, {1}}, {3, {2}}}};
+
+    REQUIRE(state.queueOf(1) == 0u);
+    REQUIRE(state.queueOf(2) == 3u);
+    REQUIRE(!state.queueOf(4).has_value());
+    REQUIRE(!state.queueOf(-1).has_value());
+    REQUIRE_NOTHROW(
+        pm::ProcessesState::validate(state.processes, state.queues));
+
+    state.enqueue(0, 4);
+    REQUIRE(state.queueOf(4) == 0u);
+    REQUIRE(state.queues.at(0) == std::deque<int32_t>{1, 4});
+
+    REQUIRE(state.dequeue(0) == 1);
+    REQUIRE(!state.queueOf(1).has_value());
+    REQUIRE(state.queueOf(4) == 0u);
+    REQUIRE(state.queues.at(0) == std::deque<int32_t>{4});
+
+    // Процесс в двух очередях
+    auto queues = state.queues;
+    queues.at(5).push_back(4);
+    REQUIRE_THROWS_AS(pm::ProcessesState::validate(state.processes, queues),
+                      pm::TypeException);
+    // Активный процесс не в очереди
+    queues = state.queues;
+    queues.at(3).clear();
+    REQUIRE_THROWS_AS(pm::ProcessesState::validate(state.processes, queues),
+                      pm::TypeException);
+  }
+
+  SECTION("Обмен очередей ProcessesState") {
+    pm::ProcessesState state{// processes
+                             {pm::Process{}.pid(1),
+                              pm::Process{}.pid(2).priority(1),
+                              pm::Process{}.pid(3).priority(1)},
+                             // queues
+                             {{0, {1}}, {1, {2, 3}}}};
+
+    state.swapQueues(0, 1);
+    REQUIRE(state.queues.at(0) == std::deque<int32_t>{2, 3});
+    REQUIRE(state.queues.at(1) == std::deque<int32_t>{1});
+    REQUIRE(state.queueOf(1) == 1u);
+    REQUIRE(state.queueOf(3) == 0u);
+
+    state.swapQueues(1, 2);
+    REQUIRE(state.queueOf(1) == 2u);
+    REQUIRE(state.highestNonEmptyQueue() == 2u);
+  }
+
+  SECTION("Непустые очереди ProcessesState") {
+    pm::ProcessesState state{// processes
+                             {pm::Process{}.pid(1),
+                              pm::Process{}.pid(2).priority(15),
+                              pm::Process{}.pid(3).priority(7)},
+                             // queues
+                             {{0, {1}}, {15, {2}}, {7, {3}}}};
+
+    REQUIRE(state.highestNonEmptyQueue() == 15u);
+
+    state.dequeue(15);
+    REQUIRE(state.highestNonEmptyQueue() == 7u);
+
+    state.dequeue(7);
+    REQUIRE(state.highestNonEmptyQueue() == 0u);
+
+    state.dequeue(0);
+    REQUIRE(!state.highestNonEmptyQueue().has_value());
+
+    state.enqueue(3, 1);
+    REQUIRE(state.highestNonEmptyQueue() == 3u);
+  }
+
+  SECTION("Добавление процесса ProcessesState") {
+    pm::ProcessesState state{// processes
+                             {pm::Process{}.pid(1),
+                              pm::Process{}.pid(4).state(
+                                  pm::ProcState::EXECUTING),
+                              pm::Process{}.pid(7).ppid(4)},
+                             // queues
+                             {{0, {1, 7}}}};
+
+    state.insertProcess(pm::Process{}.pid(5).ppid(4));
+    REQUIRE(state.processes.at(2) == pm::Process{}.pid(5).ppid(4));
+    REQUIRE(state.indexOf(5) == 2u);
+    REQUIRE(state.indexOf(7) == 3u);
+    REQUIRE(state.executingIndex() == 1u);
+    REQUIRE(state.subtree(4).size() == 3);
+
+    state.insertProcess(pm::Process{}.pid(0));
+    REQUIRE(state.indexOf(0) == 0u);
+    REQUIRE(state.indexOf(7) == 4u);
+    REQUIRE(state.executingIndex() == 2u);
+
+    // Неупорядоченный список сортируется целиком
+    pm::ProcessesState unsorted{// processes
+                                {pm::Process{}.pid(3), pm::Process{}.pid(1)},
+                                // queues
+                                {{0, {3, 1}}}};
+    unsorted.insertProcess(pm::Process{}.pid(2));
+    REQUIRE(unsorted.processes == vector{pm::Process{}.pid(1),
+                                         pm::Process{}.pid(2),
+                                         pm::Process{}.pid(3)});
+    REQUIRE(unsorted.indexOf(3) == 2u);
+
+    // Порядок нарушен заменой процесса
+    pm::ProcessesState replaced{// processes
+                                {pm::Process{}.pid(1), pm::Process{}.pid(4)},
+                                // queues
+                                {{0, {1, 4}}}};
+    replaced.setProcess(0, pm::Process{}.pid(5));
+    replaced.insertProcess(pm::Process{}.pid(2));
+    REQUIRE(replaced.processes == vector{pm::Process{}.pid(2),
+                                         pm::Process{}.pid(4),
+                                         pm::Process{}.pid(5)});
+    REQUIRE(replaced.indexOf(5) == 2u);
+  }
+
+  SECTION("Дерево процессов ProcessesState") {
+    pm::ProcessesState state{// processes
+                             {pm::Process{}.pid(0),
+                              pm::Process{}.pid(1).ppid(0),
+                              pm::Process{}.pid(2).ppid(0),
+                              pm::Process{}.pid(3).ppid(1),
+                              pm::Process{}.pid(4)},
+                             // queues
+                             {{0, {0, 1, 2, 3, 4}}}};
+
+    auto subtree = state.subtree(0);
+    std::sort(subtree.begin(), subtree.end());
+    REQUIRE(subtree == vector<int32_t>{0, 1, 2, 3});
+    REQUIRE(state.subtree(4) == vector<int32_t>{4});
+
+    state.setProcess(3, pm::Process{}.pid(3).ppid(4));
+    REQUIRE(state.subtree(4) == vector<int32_t>{4, 3});
+    REQUIRE(state.subtree(1) == vector<int32_t>{1});
+
+    state.removeProcesses({1, 4});
+    REQUIRE(state.processes == vector{pm::Process{}.pid(0),
+                                           pm::Process{}.pid(2).ppid(0),
+                                           pm::Process{}.pid(3).ppid(4)});
+    REQUIRE(state.queues.at(0) == std::deque<int32_t>{0, 2, 3});
+    REQUIRE(state.indexOf(3) == 2u);
+    REQUIRE(!state.indexOf(4).has_value());
+    REQUIRE(!state.queueOf(1).has_value());
+    REQUIRE(state.subtree(0) == vector<int32_t>{0, 2});
+
+    // PPID образуют цикл, каждый процесс посещается один раз при каждом
+    // обходе
+    pm::ProcessesState cycle{// processes
+                             {pm::Process{}.pid(1).ppid(2),
+                              pm::Process{}.pid(2).ppid(1)},
+                             // queues
+                             {{0, {1, 2}}}};
+    REQUIRE(cycle.subtree(1) == vector<int32_t>{1, 2});
+    REQUIRE(cycle.subtree(2) == vector<int32_t>{2, 1});
+    REQUIRE(cycle.subtree(1) == vector<int32_t>{1, 2});
+  }
+
+  SECTION("Индекс не влияет на сравнение ProcessesState") {
+    pm::ProcessesState state{// processes
+                             {pm::Process{}.pid(1)},
+                             // queues
+                             {{0, {1}}}};
+    auto other = state;
+    other.setProcess(0, pm::Process{}.pid(1).state(pm::ProcState::EXECUTING));
+    other.setProcess(0, pm::Process{}.pid(1));
+
+    REQUIRE(state == other);
+    REQUIRE(state.dump() == other.dump());
+  }
+
+  SECTION("Структурное связывание ProcessesState") {
+    pm::ProcessesState state{// processes
+                             {pm::Process{}.pid(1)},
+                             // queues
+                             {{0, {1}}}};
+
+    auto [processes, queues] = state;
+    REQUIRE(processes == state.processes);
+    REQUIRE(queues == state.queues);
+
+    auto &[processesRef, queuesRef] = state;
+    processesRef.push_back(pm::Process{}.pid(2));
+    queuesRef.at(1).push_back(2);
+    state.reindex();
+    REQUIRE(state.processes.size() == 2);
+    REQUIRE(state.queues.at(1).size() == 1);
+    REQUIRE(state.indexOf(2) == 1u);
+  }
 }
@@ -0,0 +1,52 @@
+#include <deque>
+#include <type_traits>
+#include <vector>
+
+#include <catch2/catch.hpp>
+
+#include <algo/processes/types.h>
+#include <algo/processes/views.h>
+
+namespace pm = ProcessesManagement;
+using std::vector;
+
+// Представление временного состояния не может быть создано
+static_assert(!std::is_constructible_v<pm::StateView, pm::ProcessesState>);
+static_assert(!std::is_constructible_v<pm::ProcessesView, vector<pm::Process>>);
+static_assert(!std::is_constructible_v<pm::QueueView, std::deque<int32_t>>);
+
+TEST_CASE("ProcessesManagement::StateView") {
+  SECTION("Просмотр состояния процессов") {
+    pm::ProcessesState state{
+        {pm::Process{}.pid(1),
+         pm::Process{}.pid(4).state(pm::ProcState::EXECUTING),
+         pm::Process{}.pid(7).priority(2)},
+        {{0, {1}}, {2, {7}}}};
+    pm::StateView view = state;
+
+    REQUIRE(view.processes().size() == 3);
+    REQUIRE(view.processes().begin() == state.processes.data());
+    REQUIRE(view.processes()[2] == state.processes[2]);
+    REQUIRE_THROWS_AS(view.processes().at(3), std::out_of_range);
+
+    REQUIRE(view.queuesCount() == state.queues.size());
+    REQUIRE(view.queue(0).front() == 1);
+    REQUIRE(view.queue(1).empty());
+    REQUIRE(view.queue(2).size() == 1);
+    REQUIRE(view.highestNonEmptyQueue() == 2u);
+
+    REQUIRE(view.indexOf(7) == 2u);
+    REQUIRE(&*view.process(7) == &state.processes[2]);
+    REQUIRE_FALSE(view.process(5).has_value());
+    REQUIRE(&*view.current() == &state.processes[1]);
+  }
+
+  SECTION("Просмотр состояния без выполняющегося процесса") {
+    auto state = pm::ProcessesState::initial();
+    pm::StateView view = state;
+
+    REQUIRE(view.processes().empty());
+    REQUIRE_FALSE(view.current().has_value());
+    REQUIRE_FALSE(view.highestNonEmptyQueue().has_value());
+  }
+}
@@ -0,0 +1,97 @@
+#include <cstddef>
+#include <vector>
+
+#include <catch2/catch.hpp>
+
+#include <algo/memory/requests.h>
+#include <algo/memory/strategies.h>
+#include <algo/memory/types.h>
+#include <algo/processes/requests.h>
+#include <algo/processes/strategies.h>
+#include <algo/processes/types.h>
+#include <utils/exceptions.h>
+#include <utils/replay.h>
+
+namespace mm = MemoryManagement;
+namespace pm = ProcessesManagement;
+
+TEST_CASE("Utils::MemoryReplayCache") {
+  mm::StrategyPtr strategy = mm::FirstAppropriateStrategy::create();
+  std::vector<mm::Request> requests = {mm::CreateProcessReq(1, 4 * 4096),
+                                       mm::CreateProcessReq(2, 2 * 4096),
+                                       mm::AllocateMemory(1, 3 * 4096),
+                                       mm::CreateProcessReq(3, 4096),
+                                       mm::TerminateProcessReq(2),
+                                       mm::AllocateMemory(3, 5 * 4096),
+                                       mm::FreeMemory(1, 4),
+                                       mm::TerminateProcessReq(1)};
+
+  std::vector<mm::MemoryState> expected = {mm::MemoryState::initial()};
+  for (const auto &request : requests) {
+    expected.push_back(strategy->processRequest(request, expected.back()));
+  }
+
+  SECTION("Получить состояния в произвольном порядке") {
+    for (std::size_t interval : {1, 3, 64}) {
+      Utils::MemoryReplayCache replay(
+          strategy, requests, mm::MemoryState::initial(), interval);
+
+      for (std::size_t count : {5, 0, 8, 2, 6, 3}) {
+        REQUIRE(replay.state(count) == expected[count]);
+      }
+    }
+  }
+
+  SECTION("Контрольные точки строятся по мере обращения к состояниям") {
+    Utils::MemoryReplayCache replay(
+        strategy, requests, mm::MemoryState::initial(), 3);
+    REQUIRE(replay.checkpoints() == 1);
+
+    replay.state(2);
+    REQUIRE(replay.checkpoints() == 1);
+
+    replay.state(7);
+    REQUIRE(replay.checkpoints() == 3);
+
+    replay.state(4);
+    REQUIRE(replay.checkpoints() == 3);
+  }
+
+  SECTION("Неверные параметры") {
+    REQUIRE_THROWS_AS(Utils::MemoryReplayCache(
+                          strategy, requests, mm::MemoryState::initial(), 0),
+                      Utils::TaskException);
+
+    Utils::MemoryReplayCache replay(
+        strategy, requests, mm::MemoryState::initial());
+    REQUIRE_THROWS_AS(replay.state(requests.size() + 1), Utils::TaskException);
+  }
+}
+
+TEST_CASE("Utils::ProcessesReplayCache") {
+  pm::StrategyPtr strategy = pm::UnixStrategy::create();
+  std::vector<pm::Request> requests = {pm::CreateProcessReq(1, -1, 3),
+                                       pm::CreateProcessReq(2, 1, 5, 0, 0, 4),
+                                       pm::CreateProcessReq(3, 1, 1, 0, 0, 2),
+                                       pm::TimeQuantumExpired(),
+                                       pm::InitIO(2),
+                                       pm::TransferControl(1),
+                                       pm::TerminateIO(2, 2),
+                                       pm::TimeQuantumExpired(),
+                                       pm::TerminateProcessReq(1),
+                                       pm::TimeQuantumExpired()};
+
+  std::vector<pm::ProcessesState> expected = {pm::ProcessesState::initial()};
+  for (const auto &request : requests) {
+    expected.push_back(strategy->processRequest(request, expected.back()));
+  }
+
+  for (std::size_t interval : {1, 4, 64}) {
+    Utils::ProcessesReplayCache replay(
+        strategy, requests, pm::ProcessesState::initial(), interval);
+
+    for (std::size_t count = requests.size() + 1; count-- > 0;) {
+      REQUIRE(replay.state(count) == expected[count]);
+    }
+  }
+}
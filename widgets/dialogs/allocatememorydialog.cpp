@@ -17,7 +17,7 @@ AllocateMemoryDialog::AllocateMemoryDialog(QWidget *parent,
       availablePages(availablePages) {
   ui->setupUi(this);
   ui->PIDEdit->setValidator(new QIntValidator(0, 255));
-  ui->sizeEdit->setValidator(new QIntValidator(1, 256));
+  ui->sizeEdit->setValidator(new QIntValidator(1, availablePages));
 
   connect(ui->buttonBox,
           &QDialogButtonBox::accepted,